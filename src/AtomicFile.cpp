@@ -0,0 +1,190 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the feed merger.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "AtomicFile.hpp"
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <vector>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+bool AtomicFile::syncFromString(const std::string& name, Sync& sync)
+{
+  if (name == "none")
+    sync = Sync::None;
+  else if (name == "file")
+    sync = Sync::File;
+  else if (name == "full")
+    sync = Sync::Full;
+  else
+    return false;
+  return true;
+}
+
+AtomicFile::AtomicFile()
+: m_FileName(""),
+  m_TempName(""),
+  m_Descriptor(-1)
+{
+}
+
+AtomicFile::~AtomicFile()
+{
+  discard();
+}
+
+bool AtomicFile::open(const std::string& fileName)
+{
+  discard();
+  //The temporary file has to be on the same file system for rename().
+  std::vector<char> name(fileName.begin(), fileName.end());
+  const std::string suffix = ".tmp-XXXXXX";
+  name.insert(name.end(), suffix.begin(), suffix.end());
+  name.push_back('\0');
+  const int fd = mkstemp(name.data());
+  if (fd == -1)
+  {
+    std::cerr << "Error: Could not create temporary file for " << fileName
+              << ": " << std::strerror(errno) << std::endl;
+    return false;
+  }
+  /* mkstemp() creates files that only the owner may read, but the target
+     may have to be readable by others, e.g. by a web server. */
+  mode_t mode;
+  struct stat info;
+  if (stat(fileName.c_str(), &info) == 0)
+    mode = info.st_mode & 07777;
+  else
+  {
+    const mode_t mask = umask(0);
+    umask(mask);
+    mode = 0666 & ~mask;
+  }
+  if (fchmod(fd, mode) != 0)
+  {
+    std::cerr << "Error: Could not set permissions of temporary file "
+              << name.data() << ": " << std::strerror(errno) << std::endl;
+    ::close(fd);
+    unlink(name.data());
+    return false;
+  }
+  m_FileName = fileName;
+  m_TempName = std::string(name.data());
+  m_Descriptor = fd;
+  return true;
+}
+
+bool AtomicFile::isOpen() const
+{
+  return (m_Descriptor != -1);
+}
+
+int AtomicFile::descriptor() const
+{
+  return m_Descriptor;
+}
+
+bool AtomicFile::write(const char* data, std::size_t size)
+{
+  if (m_Descriptor == -1)
+    return false;
+  while (size > 0)
+  {
+    const ssize_t written = ::write(m_Descriptor, data, size);
+    if (written < 0)
+    {
+      if (errno == EINTR)
+        continue;
+      std::cerr << "Error: Could not write to temporary file " << m_TempName
+                << ": " << std::strerror(errno) << std::endl;
+      return false;
+    }
+    data += written;
+    size -= static_cast<std::size_t>(written);
+  } //while
+  return true;
+}
+
+bool AtomicFile::commit(const Sync sync)
+{
+  if (m_Descriptor == -1)
+    return false;
+  if ((sync != Sync::None) && (fsync(m_Descriptor) != 0))
+  {
+    std::cerr << "Error: Could not flush temporary file " << m_TempName
+              << " to disk: " << std::strerror(errno) << std::endl;
+    discard();
+    return false;
+  }
+  const int fd = m_Descriptor;
+  m_Descriptor = -1;
+  //Errors of delayed writes may only show up when the file is closed.
+  if (::close(fd) != 0)
+  {
+    std::cerr << "Error: Could not close temporary file " << m_TempName
+              << ": " << std::strerror(errno) << std::endl;
+    discard();
+    return false;
+  }
+  if (std::rename(m_TempName.c_str(), m_FileName.c_str()) != 0)
+  {
+    std::cerr << "Error: Could not rename " << m_TempName << " to "
+              << m_FileName << ": " << std::strerror(errno) << std::endl;
+    discard();
+    return false;
+  }
+  m_TempName.clear();
+  //The rename itself is only durable when the directory is flushed, too.
+  if (sync == Sync::Full)
+  {
+    std::filesystem::path directory = std::filesystem::path(m_FileName).parent_path();
+    if (directory.empty())
+      directory = ".";
+    const int dirFd = ::open(directory.c_str(), O_RDONLY | O_DIRECTORY);
+    if ((dirFd == -1) || (fsync(dirFd) != 0))
+    {
+      std::cerr << "Error: Could not flush directory " << directory.string()
+                << " to disk: " << std::strerror(errno) << std::endl;
+      if (dirFd != -1)
+        ::close(dirFd);
+      return false;
+    }
+    ::close(dirFd);
+  }
+  return true;
+}
+
+void AtomicFile::discard()
+{
+  if (m_Descriptor != -1)
+  {
+    ::close(m_Descriptor);
+    m_Descriptor = -1;
+  }
+  if (!m_TempName.empty())
+  {
+    unlink(m_TempName.c_str());
+    m_TempName.clear();
+  }
+}
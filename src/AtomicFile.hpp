@@ -0,0 +1,124 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the feed merger.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef ATOMICFILE_HPP
+#define ATOMICFILE_HPP
+
+#include <cstddef>
+#include <string>
+
+/** \brief file that replaces its target atomically when it is committed
+ *
+ * The data is written to a temporary file in the same directory as the
+ * target file. Committing renames the temporary file over the target, so
+ * readers of the target either see the complete old content or the complete
+ * new content, but never a partially written file.
+ */
+class AtomicFile
+{
+  public:
+    /** \brief when data is flushed to the disk during commit() */
+    enum class Sync
+    {
+      None, /**< no explicit flush, the operating system decides */
+      File, /**< flush the file's data before it is renamed */
+      Full  /**< flush the file's data and the directory entry of the rename */
+    };
+
+
+    /** \brief gets the sync policy from its name
+     *
+     * \param name  the name of the policy: "none", "file" or "full"
+     * \param sync  variable that will receive the policy
+     * \return Returns true, if the name is a valid policy.
+     *         Returns false otherwise.
+     */
+    static bool syncFromString(const std::string& name, Sync& sync);
+
+
+    ///default constructor
+    AtomicFile();
+
+    /// delete copy constructor
+    AtomicFile(const AtomicFile& other) = delete;
+
+    /// delete copy assignment operator
+    AtomicFile& operator=(const AtomicFile& other) = delete;
+
+
+    /// destructor - removes the temporary file, if it was not committed
+    ~AtomicFile();
+
+
+    /** \brief creates the temporary file for the given target file
+     *
+     * \param fileName  path of the target file
+     * \return Returns true, if the temporary file was created.
+     *         Returns false, if an error occurred.
+     * \remarks A previously opened file is discarded first. The temporary
+     *          file gets the permissions of an existing target file.
+     */
+    bool open(const std::string& fileName);
+
+
+    /** \brief checks whether a temporary file is open
+     *
+     * \return Returns true, if a temporary file is open.
+     */
+    bool isOpen() const;
+
+
+    /** \brief gets the file descriptor of the temporary file
+     *
+     * \return Returns the file descriptor. Returns -1, if no file is open.
+     */
+    int descriptor() const;
+
+
+    /** \brief writes data to the temporary file
+     *
+     * \param data  pointer to the data
+     * \param size  number of bytes to write
+     * \return Returns true, if all data was written.
+     *         Returns false, if an error occurred.
+     */
+    bool write(const char* data, std::size_t size);
+
+
+    /** \brief replaces the target file with the temporary file
+     *
+     * \param sync  policy for flushing the data to the disk
+     * \return Returns true, if the target file was replaced.
+     *         Returns false, if an error occurred. The target file is not
+     *         changed in that case and the temporary file is removed.
+     */
+    bool commit(const Sync sync);
+
+
+    /** \brief closes and removes the temporary file, if any
+     */
+    void discard();
+  private:
+    std::string m_FileName; /**< path of the target file */
+    std::string m_TempName; /**< path of the temporary file */
+    int m_Descriptor; /**< descriptor of the temporary file, -1 if none is open */
+}; //class
+
+#endif // ATOMICFILE_HPP
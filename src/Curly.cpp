@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of scan-tool.
-    Copyright (C) 2015, 2016, 2017, 2022  Dirk Stolle
+    Copyright (C) 2015, 2016, 2017, 2022, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -25,7 +25,7 @@
 #include <limits>
 #include <memory>
 #include <type_traits>
-#include <curl/curl.h>
+#include <utility>
 
 size_t writeCallbackString(char *ptr, size_t size, size_t nmemb, void *userdata)
 {
@@ -98,10 +98,32 @@ Curly::Curly()
   m_followRedirects(false),
   m_maxRedirects(-1),
   m_ResponseHeaders(std::vector<std::string>()),
-  m_MaxUpstreamSpeed(0)
+  m_MaxUpstreamSpeed(0),
+  m_Compression(false),
+  m_LastDownloadedBytes(0),
+  m_LastDecodedBytes(0),
+  m_Sink(WriteSink()),
+  m_SinkBytes(0),
+  m_ReuseHandle(false),
+  m_Pool(nullptr),
+  m_Handle(nullptr),
+  m_HeaderList(nullptr),
+  m_FormFirst(nullptr),
+  m_EncodedPostFields(""),
+  m_ResponseBody("")
 {
 }
 
+Curly::~Curly()
+{
+  releaseTransfer();
+  if (nullptr != m_Handle)
+  {
+    curl_easy_cleanup(m_Handle);
+    m_Handle = nullptr;
+  }
+}
+
 void Curly::setURL(const std::string& newURL)
 {
   if (!newURL.empty())
@@ -235,21 +257,79 @@ void Curly::setMaximumRedirects(const long int maxRedirect)
     m_maxRedirects = -1; //map all negative values to -1
 }
 
-bool Curly::perform(std::string& response)
+bool Curly::usesCompression() const
+{
+  return m_Compression;
+}
+
+void Curly::enableCompression(const bool compress)
+{
+  m_Compression = compress;
+}
+
+void Curly::setWriteSink(WriteSink sink)
+{
+  m_Sink = std::move(sink);
+}
+
+bool Curly::reusesHandle() const
+{
+  return m_ReuseHandle;
+}
+
+void Curly::reuseHandle(const bool reuse)
+{
+  m_ReuseHandle = reuse;
+  //free a kept handle, if it shall not be reused anymore
+  if (!reuse && (nullptr != m_Handle))
+  {
+    releaseTransfer();
+    curl_easy_cleanup(m_Handle);
+    m_Handle = nullptr;
+  }
+}
+
+void Curly::setHandlePool(CurlyHandlePool* pool)
+{
+  //do not mix handles of different pools
+  releaseTransfer();
+  if (nullptr != m_Handle)
+  {
+    curl_easy_cleanup(m_Handle);
+    m_Handle = nullptr;
+  }
+  m_Pool = pool;
+}
+
+bool Curly::prepareTransfer()
 {
   //"minimum" URL should be something like "http://a.bc"
   if (m_URL.size() < 11)
     return false;
 
-  //initialize cURL
-  #ifdef DEBUG_MODE
-  std::clog << "curl_easy_init()..." << std::endl;
-  #endif
-  CURL * handle = curl_easy_init();
-  if (nullptr == handle)
+  //free remains of a previous transfer, if any
+  releaseTransfer();
+  m_ResponseHeaders.clear();
+  m_LastDownloadedBytes = 0;
+  m_LastDecodedBytes = 0;
+  m_SinkBytes = 0;
+
+  //initialize cURL - or take the kept or pooled handle
+  if (nullptr != m_Pool)
+  {
+    m_Handle = m_Pool->acquire();
+  }
+  else if (nullptr == m_Handle)
+  {
+    #ifdef DEBUG_MODE
+    std::clog << "curl_easy_init()..." << std::endl;
+    #endif
+    m_Handle = curl_easy_init();
+  }
+  if (nullptr == m_Handle)
   {
     //cURL error
-    std::cerr << "cURL easy init failed!" << std::endl;;
+    std::cerr << "cURL easy init failed!" << std::endl;
     return false;
   }
 
@@ -257,12 +337,12 @@ bool Curly::perform(std::string& response)
   #ifdef DEBUG_MODE
   std::clog << "curl_easy_setopt(..., URL, ...)..." << std::endl;
   #endif
-  CURLcode retCode = curl_easy_setopt(handle, CURLOPT_URL, m_URL.c_str());
+  CURLcode retCode = curl_easy_setopt(m_Handle, CURLOPT_URL, m_URL.c_str());
   if (retCode != CURLE_OK)
   {
     std::cerr << "cURL error: setting URL failed!" << std::endl;
     std::cerr << curl_easy_strerror(retCode) << std::endl;
-    curl_easy_cleanup(handle);
+    releaseTransfer();
     return false;
   }
 
@@ -270,21 +350,21 @@ bool Curly::perform(std::string& response)
   #ifdef DEBUG_MODE
   std::clog << "curl_easy_setopt(..., CURLOPT_HEADERFUNCTION, ...)..." << std::endl;
   #endif
-  retCode = curl_easy_setopt(handle, CURLOPT_HEADERFUNCTION, Curly::headerCallback);
+  retCode = curl_easy_setopt(m_Handle, CURLOPT_HEADERFUNCTION, Curly::headerCallback);
   if (retCode != CURLE_OK)
   {
     std::cerr << "cURL error: setting header function failed!" << std::endl;
     std::cerr << curl_easy_strerror(retCode) << std::endl;
-    curl_easy_cleanup(handle);
+    releaseTransfer();
     return false;
   }
   //set header data
-  retCode = curl_easy_setopt(handle, CURLOPT_HEADERDATA, this);
+  retCode = curl_easy_setopt(m_Handle, CURLOPT_HEADERDATA, this);
   if (retCode != CURLE_OK)
   {
     std::cerr << "cURL error: setting header data pointer failed!" << std::endl;
     std::cerr << curl_easy_strerror(retCode) << std::endl;
-    curl_easy_cleanup(handle);
+    releaseTransfer();
     return false;
   }
 
@@ -292,28 +372,42 @@ bool Curly::perform(std::string& response)
   // In curl 7.54.0 and later, the CURLOPT_SSLVERSION option can be used to set
   // the minimal SSL / TLS version to use. CURLOPT_SSLVERSION has been available
   // since curl 7.34.0, but then it meant the exact version, not the minimum.
-  retCode = curl_easy_setopt(handle, CURLOPT_SSLVERSION, CURL_SSLVERSION_TLSv1_2);
+  retCode = curl_easy_setopt(m_Handle, CURLOPT_SSLVERSION, CURL_SSLVERSION_TLSv1_2);
   if (retCode != CURLE_OK)
   {
     std::cerr << "cURL error: setting minimum TLS version failed!" << std::endl;
     std::cerr << curl_easy_strerror(retCode) << std::endl;
-    curl_easy_cleanup(handle);
+    releaseTransfer();
     return false;
   }
   #endif
 
+  //request compressed response
+  if (m_Compression)
+  {
+    //An empty string means: all encodings that are supported by libcurl.
+    retCode = curl_easy_setopt(m_Handle, CURLOPT_ACCEPT_ENCODING, "");
+    if (retCode != CURLE_OK)
+    {
+      std::cerr << "cURL error: setting accepted encodings failed!" << std::endl;
+      std::cerr << curl_easy_strerror(retCode) << std::endl;
+      releaseTransfer();
+      return false;
+    }
+  } //if compression is requested
+
   //set max. upload speed
   if (m_MaxUpstreamSpeed >= 512)
   {
     #ifdef DEBUG_MODE
     std::clog << "curl_easy_setopt(..., CURLOPT_MAX_SEND_SPEED_LARGE, ...)..." << std::endl;
     #endif
-    retCode = curl_easy_setopt(handle, CURLOPT_MAX_SEND_SPEED_LARGE, static_cast<curl_off_t>(m_MaxUpstreamSpeed));
+    retCode = curl_easy_setopt(m_Handle, CURLOPT_MAX_SEND_SPEED_LARGE, static_cast<curl_off_t>(m_MaxUpstreamSpeed));
     if (retCode != CURLE_OK)
     {
       std::cerr << "cURL error: limiting the upload speed failed!" << std::endl;
       std::cerr << curl_easy_strerror(retCode) << std::endl;
-      curl_easy_cleanup(handle);
+      releaseTransfer();
       return false;
     }
   } //if upload speed limit is above 511 bytes per second
@@ -322,30 +416,29 @@ bool Curly::perform(std::string& response)
   if (followsRedirects())
   {
     //make cURL follow redirects
-    retCode = curl_easy_setopt(handle, CURLOPT_FOLLOWLOCATION, 1L);
+    retCode = curl_easy_setopt(m_Handle, CURLOPT_FOLLOWLOCATION, 1L);
     if (retCode != CURLE_OK)
     {
       std::cerr << "cURL error: setting redirection mode failed!" << std::endl;
       std::cerr << curl_easy_strerror(retCode) << std::endl;
-      curl_easy_cleanup(handle);
+      releaseTransfer();
       return false;
     }
     //set limit - but only if we are not "limited" to infinite redirects
     if (maximumRedirects() >= 0)
     {
-      retCode = curl_easy_setopt(handle, CURLOPT_MAXREDIRS, maximumRedirects());
+      retCode = curl_easy_setopt(m_Handle, CURLOPT_MAXREDIRS, maximumRedirects());
       if (retCode != CURLE_OK)
       {
         std::cerr << "cURL error: setting redirection limit failed!" << std::endl;
         std::cerr << curl_easy_strerror(retCode) << std::endl;
-        curl_easy_cleanup(handle);
+        releaseTransfer();
         return false;
       } //if cURL error
     } //if redirect limit is given
   } //if redirects are followed
 
   //add custom headers
-  struct curl_slist * header_list = nullptr;
   if (!m_headers.empty())
   {
     #ifdef DEBUG_MODE
@@ -353,27 +446,25 @@ bool Curly::perform(std::string& response)
     #endif // DEBUG_MODE
     for(auto const & h: m_headers)
     {
-      header_list = curl_slist_append(header_list, h.c_str());
-      if (nullptr == header_list)
+      struct curl_slist * extended_list = curl_slist_append(m_HeaderList, h.c_str());
+      if (nullptr == extended_list)
       {
         std::cerr << "cURL error: creation of header list failed!" << std::endl;
-        std::cerr << curl_easy_strerror(retCode) << std::endl;
-        curl_easy_cleanup(handle);
+        releaseTransfer();
         return false;
       }
+      m_HeaderList = extended_list;
     } //for
     //add headers to the handle
     #ifdef DEBUG_MODE
     std::clog << "curl_easy_setopt(handle, CURLOPT_HTTPHEADER, ...)" << std::endl;
     #endif // DEBUG_MODE
-    retCode = curl_easy_setopt(handle, CURLOPT_HTTPHEADER, header_list);
+    retCode = curl_easy_setopt(m_Handle, CURLOPT_HTTPHEADER, m_HeaderList);
     if (retCode != CURLE_OK)
     {
       std::cerr << "cURL error: setting custom headers failed!" << std::endl;
       std::cerr << curl_easy_strerror(retCode) << std::endl;
-      curl_slist_free_all(header_list);
-      header_list = nullptr;
-      curl_easy_cleanup(handle);
+      releaseTransfer();
       return false;
     }
   } //if custom headers are given
@@ -382,40 +473,35 @@ bool Curly::perform(std::string& response)
   #ifdef DEBUG_MODE
   std::clog << "curl_easy_escape(...)..." << std::endl;
   #endif
-  std::string postfields("");
   if (m_Files.empty())
   {
     auto iter = m_PostFields.begin();
     while (iter != m_PostFields.end())
     {
       //escape key
-      char * c_str = curl_easy_escape(handle, iter->first.c_str(), iter->first.length());
+      char * c_str = curl_easy_escape(m_Handle, iter->first.c_str(), iter->first.length());
       if (c_str == nullptr)
       {
         //escaping failed!
         std::cerr << "cURL error: escaping of post values failed!" << std::endl;
-        curl_easy_cleanup(handle);
-        curl_slist_free_all(header_list);
-        header_list = nullptr;
+        releaseTransfer();
         return false;
       }
-      if (!postfields.empty())
-        postfields += "&"+std::string(c_str);
+      if (!m_EncodedPostFields.empty())
+        m_EncodedPostFields += "&"+std::string(c_str);
       else
-        postfields += std::string(c_str);
+        m_EncodedPostFields += std::string(c_str);
       curl_free(c_str);
       //escape value
-      c_str = curl_easy_escape(handle, iter->second.c_str(), iter->second.length());
+      c_str = curl_easy_escape(m_Handle, iter->second.c_str(), iter->second.length());
       if (c_str == nullptr)
       {
         //escaping failed!
         std::cerr << "cURL error: escaping of post values failed!" << std::endl;
-        curl_easy_cleanup(handle);
-        curl_slist_free_all(header_list);
-        header_list = nullptr;
+        releaseTransfer();
         return false;
       }
-      postfields += "=" + std::string(c_str);
+      m_EncodedPostFields += "=" + std::string(c_str);
       curl_free(c_str);
       //... and go on with next field
       ++iter;
@@ -423,29 +509,26 @@ bool Curly::perform(std::string& response)
   } //no files
 
   // --set post fields
-  if (!postfields.empty())
+  if (!m_EncodedPostFields.empty())
   {
-    retCode = curl_easy_setopt(handle, CURLOPT_POSTFIELDS, postfields.c_str());
+    retCode = curl_easy_setopt(m_Handle, CURLOPT_POSTFIELDS, m_EncodedPostFields.c_str());
     if (retCode != CURLE_OK)
     {
       std::cerr << "cURL error: setting POST fields for Curly::perform failed! Error: "
                 << curl_easy_strerror(retCode) << std::endl;
-      curl_easy_cleanup(handle);
-      curl_slist_free_all(header_list);
-      header_list = nullptr;
+      releaseTransfer();
       return false;
     }
   } //if post fields exist
 
   //multipart/formdata
-  struct curl_httppost* formFirst = nullptr;
   struct curl_httppost* formLast = nullptr;
   if (!m_Files.empty())
   {
     auto fileIter = m_Files.begin();
     while (fileIter != m_Files.end())
     {
-      CURLFORMcode errCode = curl_formadd(&formFirst, &formLast,
+      CURLFORMcode errCode = curl_formadd(&m_FormFirst, &formLast,
                              CURLFORM_COPYNAME, fileIter->first.c_str(),
                              CURLFORM_FILE, fileIter->second.c_str(),
                              CURLFORM_END);
@@ -453,10 +536,7 @@ bool Curly::perform(std::string& response)
       {
         std::cerr << "cURL error: could not add file to multipart/formdata!"
                   << std::endl;
-        curl_formfree(formFirst);
-        curl_slist_free_all(header_list);
-        header_list = nullptr;
-        curl_easy_cleanup(handle);
+        releaseTransfer();
         return false;
       }
       ++fileIter;
@@ -466,7 +546,7 @@ bool Curly::perform(std::string& response)
     auto pfIter = m_PostFields.begin();
     while (pfIter != m_PostFields.end())
     {
-      CURLFORMcode errCode = curl_formadd(&formFirst, &formLast,
+      CURLFORMcode errCode = curl_formadd(&m_FormFirst, &formLast,
                              CURLFORM_COPYNAME, pfIter->first.c_str(),
                              CURLFORM_COPYCONTENTS, pfIter->second.c_str(),
                              CURLFORM_END);
@@ -474,23 +554,17 @@ bool Curly::perform(std::string& response)
       {
         std::cerr << "cURL error: could not add file to multipart/formdata!"
                   << std::endl;
-        curl_formfree(formFirst);
-        curl_slist_free_all(header_list);
-        header_list = nullptr;
-        curl_easy_cleanup(handle);
+        releaseTransfer();
         return false;
       }
       ++pfIter;
     } //while post fields
-    retCode = curl_easy_setopt(handle, CURLOPT_HTTPPOST, formFirst);
+    retCode = curl_easy_setopt(m_Handle, CURLOPT_HTTPPOST, m_FormFirst);
     if (retCode != CURLE_OK)
     {
       std::cerr << "cURL error: setting multipart form data failed! Error: "
                 << curl_easy_strerror(retCode) << std::endl;
-      curl_formfree(formFirst);
-      curl_slist_free_all(header_list);
-      header_list = nullptr;
-      curl_easy_cleanup(handle);
+      releaseTransfer();
       return false;
     }
   } //if files are there
@@ -498,124 +572,166 @@ bool Curly::perform(std::string& response)
   //set plain post body - but only if other POST stuff is empty
   if (m_UsePostBody && m_PostFields.empty() && m_Files.empty())
   {
-    retCode = curl_easy_setopt(handle, CURLOPT_POST, 1L);
+    retCode = curl_easy_setopt(m_Handle, CURLOPT_POST, 1L);
     if (retCode != CURLE_OK)
     {
       std::cerr << "cURL error: setting POST mode for Curly::perform failed! Error: "
                 << curl_easy_strerror(retCode) << std::endl;
-      curl_easy_cleanup(handle);
-      curl_slist_free_all(header_list);
-      header_list = nullptr;
+      releaseTransfer();
       return false;
     }
-    retCode = curl_easy_setopt(handle, CURLOPT_POSTFIELDSIZE, m_PostBody.size());
+    retCode = curl_easy_setopt(m_Handle, CURLOPT_POSTFIELDSIZE, m_PostBody.size());
     if (retCode != CURLE_OK)
     {
       std::cerr << "cURL error: setting size of POST body for Curly::perform failed! Error: "
                 << curl_easy_strerror(retCode) << std::endl;
-      curl_easy_cleanup(handle);
-      curl_slist_free_all(header_list);
-      header_list = nullptr;
+      releaseTransfer();
       return false;
     }
-    retCode = curl_easy_setopt(handle, CURLOPT_POSTFIELDS, m_PostBody.c_str());
+    retCode = curl_easy_setopt(m_Handle, CURLOPT_POSTFIELDS, m_PostBody.c_str());
     if (retCode != CURLE_OK)
     {
       std::cerr << "cURL error: setting POST body for Curly::perform failed! Error: "
                 << curl_easy_strerror(retCode) << std::endl;
-      curl_easy_cleanup(handle);
-      curl_slist_free_all(header_list);
-      header_list = nullptr;
+      releaseTransfer();
       return false;
     }
   } //if post body
 
   //set write callback
-  retCode = curl_easy_setopt(handle, CURLOPT_WRITEFUNCTION, writeCallbackString);
+  if (m_Sink)
+    retCode = curl_easy_setopt(m_Handle, CURLOPT_WRITEFUNCTION, Curly::writeCallbackSink);
+  else
+    retCode = curl_easy_setopt(m_Handle, CURLOPT_WRITEFUNCTION, writeCallbackString);
   if (retCode != CURLE_OK)
   {
     std::cerr << "curl_easy_setopt() of Curly::perform could not set write function! Error: "
               << curl_easy_strerror(retCode) << std::endl;
-    curl_formfree(formFirst);
-    curl_slist_free_all(header_list);
-    header_list = nullptr;
-    curl_easy_cleanup(handle);
+    releaseTransfer();
     return false;
   }
-  //provide string stream for the data
-  std::string string_data("");
-  retCode = curl_easy_setopt(handle, CURLOPT_WRITEDATA, (void *)&string_data);
+  //provide string or sink for the data
+  if (m_Sink)
+    retCode = curl_easy_setopt(m_Handle, CURLOPT_WRITEDATA, static_cast<void*>(this));
+  else
+    retCode = curl_easy_setopt(m_Handle, CURLOPT_WRITEDATA, static_cast<void*>(&m_ResponseBody));
   if (retCode != CURLE_OK)
   {
     std::cerr << "curl_easy_setopt() of Curly::perform could not set write data! Error: "
               << curl_easy_strerror(retCode) << std::endl;
-    curl_formfree(formFirst);
-    curl_slist_free_all(header_list);
-    header_list = nullptr;
-    curl_easy_cleanup(handle);
+    releaseTransfer();
     return false;
   }
 
-  //send
-  #ifdef DEBUG_MODE
-  std::clog << "calling cURL easy perform..." << std::endl;
-  #endif
-  retCode = curl_easy_perform(handle);
-  if (retCode != CURLE_OK)
-  {
-    std::cerr << "curl_easy_perform() of Curly::perform failed! Error: "
-              << curl_easy_strerror(retCode) << std::endl;
-    curl_formfree(formFirst);
-    curl_slist_free_all(header_list);
-    header_list = nullptr;
-    curl_easy_cleanup(handle);
-    return false;
-  }
-  #ifdef DEBUG_MODE
-  else
-  {
-    std::clog << "POST request data was sent to server." << std::endl;
-  }
-  #endif
-  //free multipart/formdata, if any data was given
-  curl_formfree(formFirst);
-  formFirst = nullptr;
+  return true;
+}
 
-  //free header data, if any data was given
-  curl_slist_free_all(header_list);
-  header_list = nullptr;
+bool Curly::finishTransfer(std::string& response)
+{
+  if (nullptr == m_Handle)
+    return false;
 
   //get response code
-  retCode = curl_easy_getinfo(handle, CURLINFO_RESPONSE_CODE, &m_LastResponseCode);
+  CURLcode retCode = curl_easy_getinfo(m_Handle, CURLINFO_RESPONSE_CODE, &m_LastResponseCode);
   if (retCode != CURLE_OK)
   {
     std::cerr << "curl_easy_getinfo() of Curly::perform failed! Error: "
               << curl_easy_strerror(retCode) << std::endl;
-    curl_easy_cleanup(handle);
+    releaseTransfer();
     m_LastResponseCode = 0;
     return false;
   }
   //get content type
   char * contType = nullptr;
-  retCode = curl_easy_getinfo(handle, CURLINFO_CONTENT_TYPE, &contType);
+  retCode = curl_easy_getinfo(m_Handle, CURLINFO_CONTENT_TYPE, &contType);
   if (retCode != CURLE_OK)
   {
     std::cerr << "curl_easy_getinfo() of Curly::perform failed! Error: "
               << curl_easy_strerror(retCode) << std::endl;
-    curl_easy_cleanup(handle);
+    releaseTransfer();
     m_LastContentType.erase();
     return false;
   }
   if (contType == nullptr)
     m_LastContentType.erase();
   else
-    m_LastContentType = std::string(m_LastContentType);
+    m_LastContentType = std::string(contType);
+
+  //get size of received body data - for compressed data that is the size
+  //before decoding
+  #if CURL_AT_LEAST_VERSION(7, 55, 0)
+  curl_off_t downloaded = 0;
+  retCode = curl_easy_getinfo(m_Handle, CURLINFO_SIZE_DOWNLOAD_T, &downloaded);
+  #else
+  double downloaded = 0.0;
+  retCode = curl_easy_getinfo(m_Handle, CURLINFO_SIZE_DOWNLOAD, &downloaded);
+  #endif
+  if ((retCode != CURLE_OK) || (downloaded < 0))
+    downloaded = 0;
+  m_LastDownloadedBytes = static_cast<std::uint64_t>(downloaded);
+  m_LastDecodedBytes = m_ResponseBody.size() + m_SinkBytes;
 
-  curl_easy_cleanup(handle);
-  response = std::move(string_data);
+  response = std::move(m_ResponseBody);
+  releaseTransfer();
   return true;
 }
 
+void Curly::releaseTransfer()
+{
+  //free multipart/formdata, if any data was given
+  curl_formfree(m_FormFirst);
+  m_FormFirst = nullptr;
+  //free header data, if any data was given
+  curl_slist_free_all(m_HeaderList);
+  m_HeaderList = nullptr;
+  if (nullptr != m_Handle)
+  {
+    if (nullptr != m_Pool)
+    {
+      m_Pool->release(m_Handle);
+      m_Handle = nullptr;
+    }
+    else if (m_ReuseHandle)
+    {
+      curl_easy_reset(m_Handle);
+    }
+    else
+    {
+      curl_easy_cleanup(m_Handle);
+      m_Handle = nullptr;
+    }
+  } //if handle exists
+  m_EncodedPostFields.clear();
+  m_ResponseBody.clear();
+}
+
+bool Curly::perform(std::string& response)
+{
+  if (!prepareTransfer())
+    return false;
+
+  //send
+  #ifdef DEBUG_MODE
+  std::clog << "calling cURL easy perform..." << std::endl;
+  #endif
+  const CURLcode retCode = curl_easy_perform(m_Handle);
+  if (retCode != CURLE_OK)
+  {
+    std::cerr << "curl_easy_perform() of Curly::perform failed! Error: "
+              << curl_easy_strerror(retCode) << std::endl;
+    releaseTransfer();
+    return false;
+  }
+  #ifdef DEBUG_MODE
+  else
+  {
+    std::clog << "POST request data was sent to server." << std::endl;
+  }
+  #endif
+
+  return finishTransfer(response);
+}
+
 long Curly::getResponseCode() const
 {
   return m_LastResponseCode;
@@ -626,6 +742,16 @@ const std::string& Curly::getContentType() const
   return m_LastContentType;
 }
 
+std::uint64_t Curly::getDownloadedBytes() const
+{
+  return m_LastDownloadedBytes;
+}
+
+std::uint64_t Curly::getDecodedBytes() const
+{
+  return m_LastDecodedBytes;
+}
+
 Curly::VersionData::VersionData()
 : cURL(""),
   ssl(""),
@@ -704,6 +830,21 @@ size_t Curly::headerCallback(char* buffer, size_t size, size_t nitems, void* use
   return actualSize;
 }
 
+size_t Curly::writeCallbackSink(char* ptr, size_t size, size_t nmemb, void* userdata)
+{
+  const size_t actualSize = size * nmemb;
+  if (nullptr == userdata)
+  {
+    std::cerr << "Error: write callback received null pointer!" << std::endl;
+    return 0;
+  }
+  Curly* instance = reinterpret_cast<Curly*>(userdata);
+  if (!instance->m_Sink(ptr, actualSize))
+    return 0; //abort transfer
+  instance->m_SinkBytes += actualSize;
+  return actualSize;
+}
+
 void Curly::addResponseHeader(std::string respHeader)
 {
   //erase leading whitespaces
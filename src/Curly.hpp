@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of scan-tool.
-    Copyright (C) 2015, 2016, 2017, 2022  Dirk Stolle
+    Copyright (C) 2015, 2016, 2017, 2022, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -21,9 +21,13 @@
 #ifndef SCANTOOL_CURLY_HPP
 #define SCANTOOL_CURLY_HPP
 
+#include <cstdint>
+#include <functional>
 #include <string>
 #include <unordered_map>
 #include <vector>
+#include <curl/curl.h>
+#include "CurlyHandlePool.hpp"
 
 extern "C"
 {
@@ -42,6 +46,10 @@ class Curly
     Curly(const Curly& other) = delete;
 
 
+    /// destructor
+    ~Curly();
+
+
     /** \brief sets the new URL for the operation
      *
      * \param newURL   the new URL
@@ -190,6 +198,73 @@ class Curly
     void setMaximumRedirects(const long int maxRedirect);
 
 
+    /** \brief checks whether Curly requests compressed responses
+     *
+     * \return Returns true, if compressed responses are requested.
+     *         Returns false otherwise.
+     * \remarks Default behaviour is not to request compressed responses.
+     */
+    bool usesCompression() const;
+
+
+    /** \brief changes whether Curly requests compressed responses
+     *
+     * \param compress  Set this to true, if the server shall be asked to
+     *                  compress the response.
+     * \remarks The request will then contain an Accept-Encoding header with
+     *          all encodings the cURL library supports (e.g. gzip, deflate,
+     *          br), and the response is decoded transparently.
+     */
+    void enableCompression(const bool compress);
+
+
+    /** \brief function type for consumers of the response body
+     *
+     * The function gets a chunk of the (decoded) response body and returns
+     * true, if the transfer shall continue, or false to abort it.
+     */
+    typedef std::function<bool(const char* data, const std::size_t size)> WriteSink;
+
+
+    /** \brief sets a function that receives the response body in chunks
+     *
+     * \param sink  the function that gets each chunk of the response body as
+     *              soon as it arrives, or an empty function to collect the
+     *              body in the response string of perform() (default)
+     * \remarks If a sink is set, the response string of perform() will be
+     *          empty, because the body is not kept in memory by Curly.
+     */
+    void setWriteSink(WriteSink sink);
+
+
+    /** \brief checks whether Curly keeps its cURL handle between requests
+     *
+     * \return Returns true, if the handle is kept alive after perform().
+     *         Returns false, if the handle is freed after each request.
+     * \remarks Default behaviour is to free the handle after each request.
+     */
+    bool reusesHandle() const;
+
+
+    /** \brief changes whether Curly keeps its cURL handle between requests
+     *
+     * \param reuse  Set this to true, if the handle shall be kept alive.
+     * \remarks A kept handle also keeps its open connections and its DNS and
+     *          TLS session caches, so subsequent requests to the same host do
+     *          not need a new handshake. The handle is freed in the destructor.
+     *          This setting has no effect, if a handle pool is set.
+     */
+    void reuseHandle(const bool reuse);
+
+
+    /** \brief sets the pool that provides the cURL handle for each request
+     *
+     * \param pool  the pool to use, or nullptr to not use any pool (default)
+     * \remarks The pool has to outlive this instance.
+     */
+    void setHandlePool(CurlyHandlePool* pool);
+
+
     /** \brief performs the (POST) request
      *
      * \param response  reference to a string that will be filled with the
@@ -221,6 +296,24 @@ class Curly
     const std::string& getContentType() const;
 
 
+    /** \brief returns the number of body bytes that were received in the
+     *         last request, before they were decoded
+     *
+     * \return Returns the number of received body bytes of the last request.
+     *         Returns zero, if no request was performed yet.
+     * \remarks For a compressed response this is the compressed size.
+     */
+    std::uint64_t getDownloadedBytes() const;
+
+
+    /** \brief returns the size of the decoded response body of the last request
+     *
+     * \return Returns the size of the last response in bytes after decoding.
+     *         Returns zero, if no request was performed yet.
+     */
+    std::uint64_t getDecodedBytes() const;
+
+
     /** \brief structure to hold version information about the underlying cURL
      *         library
      */
@@ -259,6 +352,40 @@ class Curly
      */
     const std::vector<std::string>& responseHeaders() const;
   private:
+    friend class CurlyMulti;
+
+
+    /** \brief creates and configures the cURL handle for the next request
+     *
+     * \return Returns true, if the handle is ready to be performed.
+     *         Returns false, if an error occurred.
+     * \remarks On success, the handle is available in m_Handle and the
+     *          response will be written to m_ResponseBody. The handle has to
+     *          be released via finishTransfer() or releaseTransfer().
+     */
+    bool prepareTransfer();
+
+
+    /** \brief gets the information about a performed transfer and releases
+     *         all resources of that transfer
+     *
+     * \param response  reference to a string that will be filled with the
+     *                  request's response
+     * \return Returns true, if the transfer information could be retrieved.
+     *         Returns false otherwise.
+     */
+    bool finishTransfer(std::string& response);
+
+
+    /** \brief frees all data that belongs to the current transfer
+     *
+     * \remarks The cURL handle is given back to the pool, if a pool is set.
+     *          Otherwise it is reset for the next transfer, if the handle is
+     *          reused, or it is freed.
+     */
+    void releaseTransfer();
+
+
     /** \brief callback for response headers
      *
      * \param buffer   data of header (might not be NUL-terminated)
@@ -269,6 +396,16 @@ class Curly
      */
     static size_t headerCallback(char* buffer, size_t size, size_t nitems, void* userdata);
 
+    /** \brief callback for the response body, if a write sink is set
+     *
+     * \param ptr      chunk of the response body (not NUL-terminated)
+     * \param size     size of an item
+     * \param nmemb    number of items
+     * \param userdata pointer to the Curly instance
+     * \return Returns the size of the processed data, or zero to abort.
+     */
+    static size_t writeCallbackSink(char* ptr, size_t size, size_t nmemb, void* userdata);
+
     /** \brief adds a new header to the list of response headers
      *
      * \param respHeader   the new header line
@@ -287,6 +424,18 @@ class Curly
     long int m_maxRedirects; /**< maximum number of redirects that Curly will follow */
     std::vector<std::string> m_ResponseHeaders; /**< response headers returned by the last request */
     unsigned int m_MaxUpstreamSpeed; /**< limit for upstream / upload in bytes per second */
+    bool m_Compression; /**< whether to request compressed responses */
+    std::uint64_t m_LastDownloadedBytes; /**< received body bytes of the last request */
+    std::uint64_t m_LastDecodedBytes; /**< decoded body size of the last request */
+    WriteSink m_Sink; /**< consumer of the response body, may be empty */
+    std::uint64_t m_SinkBytes; /**< number of bytes given to the sink in the current transfer */
+    bool m_ReuseHandle; /**< whether to keep the cURL handle between transfers */
+    CurlyHandlePool* m_Pool; /**< pool that provides the handles, may be nullptr */
+    CURL* m_Handle; /**< cURL handle of the current transfer */
+    struct curl_slist* m_HeaderList; /**< list of custom headers of the current transfer */
+    struct curl_httppost* m_FormFirst; /**< multipart/formdata of the current transfer */
+    std::string m_EncodedPostFields; /**< URL-encoded post fields of the current transfer */
+    std::string m_ResponseBody; /**< response data of the current transfer */
 }; //class Curly
 
 #endif // SCANTOOL_CURLY_HPP
@@ -0,0 +1,102 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the feed merger.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "CurlyHandlePool.hpp"
+#include <iostream>
+
+CurlyHandlePool::CurlyHandlePool()
+: m_Share(curl_share_init()),
+  m_Idle(std::vector<CURL*>())
+{
+  if (nullptr == m_Share)
+  {
+    std::cerr << "cURL share init failed! Handles will not share caches."
+              << std::endl;
+    return;
+  }
+  curl_share_setopt(m_Share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+  curl_share_setopt(m_Share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+  /* Transfers of a multi handle use the connection cache of the multi handle,
+     which is gone after the transfers are done. A shared connection cache
+     lives as long as the pool, so later multi handles can reuse connections.
+     It also means that any idle handle can reuse a connection to any host,
+     so the idle handles do not need to be grouped by host. */
+  if (curl_share_setopt(m_Share, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT) != CURLSHE_OK)
+    std::cerr << "cURL cannot share connections. They will not be reused." << std::endl;
+}
+
+CurlyHandlePool::~CurlyHandlePool()
+{
+  for (CURL* handle : m_Idle)
+  {
+    curl_easy_cleanup(handle);
+  } //for
+  m_Idle.clear();
+  if (nullptr != m_Share)
+  {
+    if (curl_share_cleanup(m_Share) != CURLSHE_OK)
+      std::cerr << "cURL share cleanup failed, share is still in use!" << std::endl;
+    m_Share = nullptr;
+  }
+}
+
+CURL* CurlyHandlePool::acquire()
+{
+  CURL* handle = nullptr;
+  if (!m_Idle.empty())
+  {
+    handle = m_Idle.back();
+    m_Idle.pop_back();
+  }
+  else
+  {
+    handle = curl_easy_init();
+    if (nullptr == handle)
+    {
+      std::cerr << "cURL easy init failed!" << std::endl;
+      return nullptr;
+    }
+  }
+  if (nullptr != m_Share)
+  {
+    const CURLcode retCode = curl_easy_setopt(handle, CURLOPT_SHARE, m_Share);
+    if (retCode != CURLE_OK)
+    {
+      std::cerr << "cURL error: setting share handle failed! "
+                << curl_easy_strerror(retCode) << std::endl;
+    }
+  }
+  return handle;
+}
+
+void CurlyHandlePool::release(CURL* handle)
+{
+  if (nullptr == handle)
+    return;
+  // Reset keeps open connections as well as DNS and session caches, but
+  // removes all options of the previous transfer.
+  curl_easy_reset(handle);
+  m_Idle.push_back(handle);
+}
+
+std::size_t CurlyHandlePool::idleHandles() const
+{
+  return m_Idle.size();
+}
@@ -0,0 +1,85 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the feed merger.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef CURLYHANDLEPOOL_HPP
+#define CURLYHANDLEPOOL_HPP
+
+#include <vector>
+#include <curl/curl.h>
+
+/** \brief keeps cURL handles alive between transfers
+ *
+ * All handles of the pool share one connection cache, so a transfer can
+ * reuse an open connection to its host and skip the TCP and TLS handshake,
+ * no matter which handle did the previous transfer to that host. This works
+ * for transfers of different CurlyMulti instances, too. The handles also
+ * share the DNS cache and the TLS session cache, so even new connections to
+ * a known host are cheaper.
+ *
+ * The pool is not thread-safe. It has to outlive all Curly instances that
+ * use it.
+ */
+class CurlyHandlePool
+{
+  public:
+    ///default constructor
+    CurlyHandlePool();
+
+    /// delete copy constructor
+    CurlyHandlePool(const CurlyHandlePool& other) = delete;
+
+    /// delete copy assignment operator
+    CurlyHandlePool& operator=(const CurlyHandlePool& other) = delete;
+
+
+    /// destructor - frees all idle handles
+    ~CurlyHandlePool();
+
+
+    /** \brief gets a handle for a transfer
+     *
+     * \return Returns an idle handle of the pool, if there is one. Otherwise
+     *         a new handle is created.
+     *         Returns nullptr, if no handle could be created.
+     * \remarks The handle is in its default state, i.e. all options except
+     *          the shared caches are unset. It has to be given back with
+     *          release() when the transfer is done.
+     */
+    CURL* acquire();
+
+
+    /** \brief gives a handle back to the pool
+     *
+     * \param handle  the handle, must not be part of a multi handle anymore
+     */
+    void release(CURL* handle);
+
+
+    /** \brief gets the number of idle handles in the pool
+     *
+     * \return Returns the number of handles that are currently not in use.
+     */
+    std::size_t idleHandles() const;
+  private:
+    CURLSH* m_Share; /**< shared connection, DNS and TLS session cache of all handles */
+    std::vector<CURL*> m_Idle; /**< handles that are currently not in use */
+}; //class CurlyHandlePool
+
+#endif // CURLYHANDLEPOOL_HPP
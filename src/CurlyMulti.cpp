@@ -0,0 +1,206 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the feed merger.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "CurlyMulti.hpp"
+#include <iostream>
+#include <unordered_map>
+
+CurlyMulti::Result::Result()
+: url(""),
+  success(false),
+  responseCode(0),
+  response(""),
+  error("")
+{
+}
+
+CurlyMulti::CurlyMulti()
+: m_Transfers(std::vector<std::unique_ptr<Curly> >()),
+  m_MaxTransfers(8),
+  m_Pool(nullptr),
+  m_Multi(nullptr)
+{
+}
+
+CurlyMulti::~CurlyMulti()
+{
+  //Transfers have to give their handles back before the multi handle is gone.
+  m_Transfers.clear();
+  if (nullptr != m_Multi)
+  {
+    curl_multi_cleanup(m_Multi);
+    m_Multi = nullptr;
+  }
+}
+
+Curly& CurlyMulti::add(const std::string& url)
+{
+  m_Transfers.push_back(std::make_unique<Curly>());
+  m_Transfers.back()->setURL(url);
+  m_Transfers.back()->setHandlePool(m_Pool);
+  return *m_Transfers.back();
+}
+
+std::size_t CurlyMulti::size() const
+{
+  return m_Transfers.size();
+}
+
+const Curly& CurlyMulti::transfer(const std::size_t index) const
+{
+  return *m_Transfers.at(index);
+}
+
+unsigned int CurlyMulti::maximumTransfers() const
+{
+  return m_MaxTransfers;
+}
+
+void CurlyMulti::setMaximumTransfers(const unsigned int maxTransfers)
+{
+  if (maxTransfers > 0)
+    m_MaxTransfers = maxTransfers;
+  else
+    m_MaxTransfers = 1;
+}
+
+void CurlyMulti::setHandlePool(CurlyHandlePool* pool)
+{
+  m_Pool = pool;
+  for (auto& curly : m_Transfers)
+  {
+    curly->setHandlePool(pool);
+  }
+}
+
+bool CurlyMulti::performAll(std::vector<Result>& results)
+{
+  results = std::vector<Result>(m_Transfers.size());
+  for (std::size_t i = 0; i < m_Transfers.size(); ++i)
+  {
+    results[i].url = m_Transfers[i]->getURL();
+  }
+  if (m_Transfers.empty())
+    return true;
+
+  if (nullptr == m_Multi)
+  {
+    m_Multi = curl_multi_init();
+    if (nullptr == m_Multi)
+    {
+      std::cerr << "cURL multi init failed!" << std::endl;
+      return false;
+    }
+  }
+  CURLM * multi = m_Multi;
+
+  //maps handles of running transfers to the index of the transfer
+  std::unordered_map<CURL*, std::size_t> running;
+  std::size_t next = 0;
+  bool aborted = false;
+  while ((next < m_Transfers.size()) || !running.empty())
+  {
+    //start new transfers as long as the limit allows it
+    while ((next < m_Transfers.size()) && (running.size() < m_MaxTransfers))
+    {
+      Curly& curly = *m_Transfers[next];
+      if (!curly.prepareTransfer())
+      {
+        results[next].error = "Transfer could not be prepared.";
+        ++next;
+        continue;
+      }
+      const CURLMcode addCode = curl_multi_add_handle(multi, curly.m_Handle);
+      if (addCode != CURLM_OK)
+      {
+        results[next].error = curl_multi_strerror(addCode);
+        curly.releaseTransfer();
+        ++next;
+        continue;
+      }
+      running[curly.m_Handle] = next;
+      ++next;
+    } //while
+
+    int stillRunning = 0;
+    CURLMcode multiCode = curl_multi_perform(multi, &stillRunning);
+    if (multiCode != CURLM_OK)
+    {
+      std::cerr << "curl_multi_perform() of CurlyMulti::performAll failed! Error: "
+                << curl_multi_strerror(multiCode) << std::endl;
+      aborted = true;
+      break;
+    }
+
+    //collect finished transfers
+    int messagesLeft = 0;
+    CURLMsg * msg = nullptr;
+    while ((msg = curl_multi_info_read(multi, &messagesLeft)) != nullptr)
+    {
+      if (msg->msg != CURLMSG_DONE)
+        continue;
+      const auto iter = running.find(msg->easy_handle);
+      if (iter == running.end())
+        continue;
+      const std::size_t index = iter->second;
+      running.erase(iter);
+      Curly& curly = *m_Transfers[index];
+      curl_multi_remove_handle(multi, curly.m_Handle);
+      if (msg->data.result != CURLE_OK)
+      {
+        results[index].error = curl_easy_strerror(msg->data.result);
+        curly.releaseTransfer();
+        continue;
+      }
+      results[index].success = curly.finishTransfer(results[index].response);
+      results[index].responseCode = curly.getResponseCode();
+      if (!results[index].success)
+        results[index].error = "Could not get transfer information.";
+    } //while messages
+
+    //Only wait, if there is no transfer waiting for a free slot.
+    const bool canStartMore = (running.size() < m_MaxTransfers) && (next < m_Transfers.size());
+    if (!canStartMore && ((stillRunning > 0) || !running.empty()))
+    {
+      multiCode = curl_multi_wait(multi, nullptr, 0, 1000, nullptr);
+      if (multiCode != CURLM_OK)
+      {
+        std::cerr << "curl_multi_wait() of CurlyMulti::performAll failed! Error: "
+                  << curl_multi_strerror(multiCode) << std::endl;
+        aborted = true;
+        break;
+      }
+    } //if
+  } //while
+
+  //clean up transfers that are still running due to errors
+  for (const auto& item : running)
+  {
+    curl_multi_remove_handle(multi, item.first);
+    m_Transfers[item.second]->releaseTransfer();
+    results[item.second].error = "Transfer was aborted.";
+  } //for
+  //transfers that never started due to errors
+  for (; next < m_Transfers.size(); ++next)
+  {
+    results[next].error = "Transfer was not started.";
+  } //for
+  return !aborted;
+}
@@ -0,0 +1,137 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the feed merger.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef CURLYMULTI_HPP
+#define CURLYMULTI_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "Curly.hpp"
+
+/** \brief performs several Curly transfers concurrently
+ *
+ * All transfers are driven by a single event loop (cURL's multi interface),
+ * so the total time of all transfers is roughly the time of the slowest
+ * transfer instead of the sum of all transfers.
+ */
+class CurlyMulti
+{
+  public:
+    /** \brief result of a single transfer
+     */
+    struct Result
+    {
+      /** default constructor */
+      Result();
+
+      std::string url;    /**< URL of the transfer */
+      bool success;       /**< whether the transfer could be performed */
+      long responseCode;  /**< response code, zero if there is none */
+      std::string response; /**< the transfer's response body */
+      std::string error;  /**< error message, if the transfer failed */
+    }; //struct
+
+
+    ///default constructor
+    CurlyMulti();
+
+    /// delete copy constructor
+    CurlyMulti(const CurlyMulti& other) = delete;
+
+
+    /// destructor
+    ~CurlyMulti();
+
+
+    /** \brief adds a new transfer for the given URL
+     *
+     * \param url  the URL of the transfer
+     * \return Returns a reference to the Curly instance of the transfer. It
+     *         can be used to change further settings of the transfer (e.g.
+     *         redirects) before performAll() is called.
+     */
+    Curly& add(const std::string& url);
+
+
+    /** \brief gets the number of added transfers
+     *
+     * \return Returns the number of added transfers.
+     */
+    std::size_t size() const;
+
+
+    /** \brief gets the Curly instance of a transfer
+     *
+     * \param index  zero-based index of the transfer, in order of addition
+     * \return Returns the Curly instance of the transfer. It can be used to
+     *         get the response headers and the content type of a finished
+     *         transfer.
+     */
+    const Curly& transfer(const std::size_t index) const;
+
+
+    /** \brief gets the maximum number of transfers that run at the same time
+     *
+     * \return Returns the maximum number of concurrent transfers.
+     */
+    unsigned int maximumTransfers() const;
+
+
+    /** \brief sets the maximum number of transfers that run at the same time
+     *
+     * \param maxTransfers  the new maximum number of concurrent transfers
+     * \remarks Zero is not a sensible value and will be mapped to one.
+     *          Preset value is eight.
+     */
+    void setMaximumTransfers(const unsigned int maxTransfers);
+
+
+    /** \brief sets the pool that provides the cURL handles of the transfers
+     *
+     * \param pool  the pool to use, or nullptr to not use any pool (default)
+     * \remarks The pool is used for all transfers, including the ones that
+     *          were added before. It has to outlive this instance.
+     */
+    void setHandlePool(CurlyHandlePool* pool);
+
+
+    /** \brief performs all added transfers
+     *
+     * \param results  vector that will be filled with the transfers' results,
+     *                 in the same order as the transfers were added
+     * \return Returns true, if the transfers could be run. Note that single
+     *         transfers may still have failed, check the success flag of each
+     *         result.
+     *         Returns false, if the transfers could not be run at all or
+     *         had to be aborted. Aborted transfers and transfers that were
+     *         not started have an error message in their result.
+     * \remarks The underlying multi handle is kept alive between calls, so
+     *          its connection cache can be used by later calls, too.
+     */
+    bool performAll(std::vector<Result>& results);
+  private:
+    std::vector<std::unique_ptr<Curly> > m_Transfers; /**< all transfers */
+    unsigned int m_MaxTransfers; /**< maximum number of concurrent transfers */
+    CurlyHandlePool* m_Pool; /**< pool that provides the handles, may be nullptr */
+    CURLM* m_Multi; /**< multi handle, created on first use */
+}; //class CurlyMulti
+
+#endif // CURLYMULTI_HPP
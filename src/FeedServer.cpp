@@ -0,0 +1,427 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the feed merger.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "FeedServer.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#include "GzipStream.hpp"
+#include "StringFunctions.hpp"
+
+//maximum size of the request line and headers of a request
+const std::size_t cMaximumRequestSize = 16384;
+
+//seconds that an idle connection is kept open
+const int cIdleTimeout = 15;
+
+//maximum number of connections that are served at the same time
+const std::size_t cMaximumConnections = 64;
+
+/* Removes leading and trailing spaces and tabs. */
+static std::string trimmed(const std::string& text)
+{
+  const auto first = text.find_first_not_of(" \t");
+  if (first == std::string::npos)
+    return std::string();
+  const auto last = text.find_last_not_of(" \t");
+  return text.substr(first, last - first + 1);
+}
+
+/* Converts ASCII letters to lower case. */
+static std::string lowerCase(std::string text)
+{
+  std::transform(text.begin(), text.end(), text.begin(), [](const char c)
+  {
+    return ((c >= 'A') && (c <= 'Z')) ? static_cast<char>(c - 'A' + 'a') : c;
+  });
+  return text;
+}
+
+/* Checks whether the Accept-Encoding header allows gzip. */
+static bool acceptsGzip(const std::string& acceptEncoding)
+{
+  for (const auto& element : splitAtSeparator(acceptEncoding, ','))
+  {
+    const auto parameters = splitAtSeparator(element, ';');
+    const std::string coding = lowerCase(trimmed(parameters.front()));
+    if ((coding != "gzip") && (coding != "x-gzip") && (coding != "*"))
+      continue;
+    //"q=0" means that the coding is not acceptable.
+    bool refused = false;
+    for (std::size_t idx = 1; idx < parameters.size(); ++idx)
+    {
+      const std::string parameter = lowerCase(trimmed(parameters[idx]));
+      if ((parameter == "q=0") || (parameter == "q=0.0") || (parameter == "q=0.00")
+          || (parameter == "q=0.000"))
+        refused = true;
+    } //for
+    return !refused;
+  } //for
+  return false;
+}
+
+/* Checks whether the If-None-Match header matches the entity tag. */
+static bool matchesETag(const std::string& ifNoneMatch, const std::string& etag)
+{
+  for (const auto& element : splitAtSeparator(ifNoneMatch, ','))
+  {
+    std::string tag = trimmed(element);
+    if (tag == "*")
+      return true;
+    //Weak comparison is used for If-None-Match.
+    if (tag.substr(0, 2) == "W/")
+      tag.erase(0, 2);
+    if (tag == etag)
+      return true;
+  } //for
+  return false;
+}
+
+/* Sends the head and the body of a response without joining them first.
+   Returns true, if everything was sent. */
+static bool sendResponse(const int fd, const std::string& head, const std::string* body)
+{
+  iovec parts[2];
+  parts[0].iov_base = const_cast<char*>(head.data());
+  parts[0].iov_len = head.size();
+  parts[1].iov_base = (body != nullptr) ? const_cast<char*>(body->data()) : nullptr;
+  parts[1].iov_len = (body != nullptr) ? body->size() : 0;
+  msghdr message;
+  std::memset(&message, 0, sizeof(message));
+  message.msg_iov = parts;
+  message.msg_iovlen = 2;
+  while ((parts[0].iov_len > 0) || (parts[1].iov_len > 0))
+  {
+    //sendmsg() instead of writev(), because only send functions take MSG_NOSIGNAL.
+    const ssize_t count = sendmsg(fd, &message, MSG_NOSIGNAL);
+    if ((count < 0) && (errno == EINTR))
+      continue;
+    if (count <= 0)
+      return false;
+    std::size_t remaining = static_cast<std::size_t>(count);
+    for (iovec& part : parts)
+    {
+      const std::size_t done = std::min(remaining, part.iov_len);
+      part.iov_base = static_cast<char*>(part.iov_base) + done;
+      part.iov_len -= done;
+      remaining -= done;
+    } //for
+  } //while
+  return true;
+}
+
+bool FeedServer::parseListenAddress(const std::string& text, std::string& address, uint16_t& port)
+{
+  const auto colon = text.rfind(':');
+  const std::string host = (colon == std::string::npos) ? "127.0.0.1" : text.substr(0, colon);
+  const std::string number = (colon == std::string::npos) ? text : text.substr(colon + 1);
+  in_addr parsed;
+  if (inet_pton(AF_INET, host.c_str(), &parsed) != 1)
+    return false;
+  int value = 0;
+  if (!stringToInt(number, value) || (value <= 0) || (value > 65535))
+    return false;
+  address = host;
+  port = static_cast<uint16_t>(value);
+  return true;
+}
+
+FeedServer::FeedServer()
+: m_Snapshot(nullptr),
+  m_Listener(-1),
+  m_Port(0),
+  m_Stop(false),
+  m_Acceptor(std::thread()),
+  m_Mutex(),
+  m_Closed(),
+  m_Connections(std::unordered_set<int>())
+{
+}
+
+FeedServer::~FeedServer()
+{
+  stop();
+}
+
+bool FeedServer::start(const std::string& address, const uint16_t port)
+{
+  stop();
+  sockaddr_in socketAddress;
+  std::memset(&socketAddress, 0, sizeof(socketAddress));
+  socketAddress.sin_family = AF_INET;
+  socketAddress.sin_port = htons(port);
+  if (inet_pton(AF_INET, address.c_str(), &socketAddress.sin_addr) != 1)
+  {
+    std::cerr << "Error: " << address << " is not a valid IPv4 address!" << std::endl;
+    return false;
+  }
+  const int fd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (fd == -1)
+  {
+    std::cerr << "Error: Could not create socket: " << std::strerror(errno) << std::endl;
+    return false;
+  }
+  //Allow a quick restart while old connections are still in TIME_WAIT.
+  const int enable = 1;
+  setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+  if ((bind(fd, reinterpret_cast<const sockaddr*>(&socketAddress), sizeof(socketAddress)) != 0)
+      || (listen(fd, SOMAXCONN) != 0))
+  {
+    std::cerr << "Error: Could not listen on " << address << ":" << port << ": "
+              << std::strerror(errno) << std::endl;
+    close(fd);
+    return false;
+  }
+  socklen_t length = sizeof(socketAddress);
+  getsockname(fd, reinterpret_cast<sockaddr*>(&socketAddress), &length);
+  m_Port = ntohs(socketAddress.sin_port);
+  m_Listener = fd;
+  m_Stop = false;
+  m_Acceptor = std::thread(&FeedServer::acceptLoop, this);
+  return true;
+}
+
+uint16_t FeedServer::port() const
+{
+  return m_Port;
+}
+
+void FeedServer::stop()
+{
+  if (m_Listener == -1)
+    return;
+  m_Stop = true;
+  m_Acceptor.join();
+  close(m_Listener);
+  m_Listener = -1;
+  m_Port = 0;
+  //Wake up connections that wait for requests, and wait until they are gone.
+  std::unique_lock<std::mutex> lock(m_Mutex);
+  for (const int fd : m_Connections)
+  {
+    shutdown(fd, SHUT_RDWR);
+  } //for
+  m_Closed.wait(lock, [this] { return m_Connections.empty(); });
+}
+
+bool FeedServer::publish(const std::string& feed)
+{
+  auto snapshot = std::make_shared<Snapshot>();
+  snapshot->body = feed;
+  if (!GzipStream::compress(feed, snapshot->gzipBody))
+    return false;
+  std::ostringstream etag;
+  etag << '"' << std::hex << std::hash<std::string>()(feed) << '-' << feed.size();
+  //Both encodings are different representations, so they need different strong ETags.
+  snapshot->etag = etag.str() + '"';
+  snapshot->gzipETag = etag.str() + "-gz\"";
+  //Requests that are in progress keep the old snapshot until they are done.
+  std::atomic_store(&m_Snapshot, std::shared_ptr<const Snapshot>(std::move(snapshot)));
+  return true;
+}
+
+void FeedServer::acceptLoop()
+{
+  while (!m_Stop)
+  {
+    {
+      //Connections beyond the limit stay in the listen backlog for now.
+      std::unique_lock<std::mutex> lock(m_Mutex);
+      if (!m_Closed.wait_for(lock, std::chrono::milliseconds(200),
+                             [this] { return m_Connections.size() < cMaximumConnections; }))
+        continue;
+    }
+    pollfd listener;
+    listener.fd = m_Listener;
+    listener.events = POLLIN;
+    listener.revents = 0;
+    //The timeout limits how long stop() has to wait.
+    if (poll(&listener, 1, 200) <= 0)
+      continue;
+    const int fd = accept4(m_Listener, nullptr, nullptr, SOCK_CLOEXEC);
+    if (fd == -1)
+      continue;
+    timeval timeout;
+    timeout.tv_sec = cIdleTimeout;
+    timeout.tv_usec = 0;
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+    {
+      std::lock_guard<std::mutex> lock(m_Mutex);
+      m_Connections.insert(fd);
+    }
+    //Slow clients must not block others, so every connection gets a thread.
+    //The limit above keeps the number of threads bounded.
+    std::thread(&FeedServer::serveConnection, this, fd).detach();
+  } //while
+}
+
+void FeedServer::serveConnection(const int fd)
+{
+  std::string buffer;
+  bool keepAlive = true;
+  while (keepAlive && !m_Stop)
+  {
+    //Read until the end of the headers.
+    std::size_t end = buffer.find("\r\n\r\n");
+    while ((end == std::string::npos) && (buffer.size() <= cMaximumRequestSize))
+    {
+      char chunk[4096];
+      const ssize_t received = recv(fd, chunk, sizeof(chunk), 0);
+      if ((received < 0) && (errno == EINTR))
+        continue;
+      if (received <= 0)
+        break;
+      buffer.append(chunk, static_cast<std::size_t>(received));
+      end = buffer.find("\r\n\r\n");
+    } //while
+    Response response;
+    if (end == std::string::npos)
+    {
+      //Connection was closed, timed out or sent garbage.
+      if (buffer.size() <= cMaximumRequestSize)
+        break;
+      response.head = "HTTP/1.1 431 Request Header Fields Too Large\r\n"
+                      "Content-Length: 0\r\nConnection: close\r\n\r\n";
+      response.body = nullptr;
+      keepAlive = false;
+    }
+    else
+    {
+      response = respond(buffer.substr(0, end), keepAlive);
+      buffer.erase(0, end + 4);
+    }
+    if (!sendResponse(fd, response.head, response.body))
+      keepAlive = false;
+  } //while
+  //Remove the socket before closing it, so that stop() never shuts down a
+  //descriptor number that has already been reused by another socket.
+  std::lock_guard<std::mutex> lock(m_Mutex);
+  m_Connections.erase(fd);
+  close(fd);
+  m_Closed.notify_all();
+}
+
+FeedServer::Response FeedServer::respond(const std::string& request, bool& keepAlive) const
+{
+  std::vector<std::string> lines = splitAtSeparator(request, '\n');
+  for (auto& line : lines)
+  {
+    if (!line.empty() && (line.back() == '\r'))
+      line.pop_back();
+  } //for
+  const std::vector<std::string> requestLine = splitAtSeparator(lines.front(), ' ');
+  std::string acceptEncoding;
+  std::string ifNoneMatch;
+  std::string connection;
+  bool hasBody = false;
+  for (std::size_t idx = 1; idx < lines.size(); ++idx)
+  {
+    const auto colon = lines[idx].find(':');
+    if (colon == std::string::npos)
+      continue;
+    const std::string name = lowerCase(trimmed(lines[idx].substr(0, colon)));
+    const std::string value = trimmed(lines[idx].substr(colon + 1));
+    if (name == "accept-encoding")
+      acceptEncoding = value;
+    else if (name == "if-none-match")
+      ifNoneMatch = value;
+    else if (name == "connection")
+      connection = lowerCase(value);
+    else if (((name == "content-length") && (value != "0"))
+             || (name == "transfer-encoding"))
+      hasBody = true;
+  } //for
+
+  std::string status;
+  std::string headers;
+  Response response;
+  response.body = nullptr;
+  //A request body is never read, so the connection cannot be reused.
+  keepAlive = !hasBody && (requestLine.size() == 3) && (requestLine[2] == "HTTP/1.1")
+              && (connection != "close");
+  if ((requestLine.size() != 3) || (requestLine[2].substr(0, 5) != "HTTP/"))
+  {
+    status = "400 Bad Request";
+  }
+  else if ((requestLine[0] != "GET") && (requestLine[0] != "HEAD"))
+  {
+    status = "405 Method Not Allowed";
+    headers = "Allow: GET, HEAD\r\n";
+  }
+  else if (requestLine[1].substr(0, requestLine[1].find('?')) != "/")
+  {
+    status = "404 Not Found";
+  }
+  else
+  {
+    response.snapshot = std::atomic_load(&m_Snapshot);
+    const Snapshot* snapshot = response.snapshot.get();
+    if (snapshot == nullptr)
+    {
+      status = "503 Service Unavailable";
+      headers = "Retry-After: 10\r\n";
+    }
+    else
+    {
+      const bool gzip = acceptsGzip(acceptEncoding);
+      const std::string& etag = gzip ? snapshot->gzipETag : snapshot->etag;
+      headers = "ETag: " + etag + "\r\nVary: Accept-Encoding\r\n";
+      if (!ifNoneMatch.empty() && matchesETag(ifNoneMatch, etag))
+      {
+        status = "304 Not Modified";
+      }
+      else
+      {
+        status = "200 OK";
+        headers += "Content-Type: application/rss+xml; charset=UTF-8\r\n";
+        if (gzip)
+        {
+          headers += "Content-Encoding: gzip\r\n";
+          response.body = &snapshot->gzipBody;
+        }
+        else
+          response.body = &snapshot->body;
+      }
+    }
+  }
+
+  response.head = "HTTP/1.1 " + status + "\r\n" + headers;
+  if (status.substr(0, 3) != "304")
+  {
+    const std::size_t length = (response.body != nullptr) ? response.body->size() : 0;
+    response.head += "Content-Length: " + std::to_string(length) + "\r\n";
+  }
+  response.head += keepAlive ? "Connection: keep-alive\r\n\r\n" : "Connection: close\r\n\r\n";
+  if ((requestLine.size() != 3) || (requestLine[0] == "HEAD"))
+    response.body = nullptr;
+  return response;
+}
@@ -0,0 +1,154 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the feed merger.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef FEEDSERVER_HPP
+#define FEEDSERVER_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+
+/** \brief minimal HTTP/1.1 server that serves the merged feed from memory
+ *
+ * The feed is serialised and compressed once per update. Requests for "/"
+ * get the current version, gzip-compressed if the client accepts that, and
+ * conditional requests with If-None-Match get "304 Not Modified" when the
+ * ETag still matches. An update swaps the served version atomically, so
+ * requests never wait for a merge. The number of open connections is
+ * limited; further clients wait in the listen backlog until one is closed.
+ */
+class FeedServer
+{
+  public:
+    /** \brief splits a listen address of the form [ADDRESS:]PORT
+     *
+     * \param text     the text, e.g. "8080" or "0.0.0.0:8080"
+     * \param address  variable that will receive the IPv4 address; it is
+     *                 "127.0.0.1", if text contains only the port
+     * \param port     variable that will receive the port
+     * \return Returns true, if the text is a valid listen address.
+     *         Returns false otherwise.
+     */
+    static bool parseListenAddress(const std::string& text, std::string& address, uint16_t& port);
+
+
+    ///default constructor
+    FeedServer();
+
+    /// delete copy constructor
+    FeedServer(const FeedServer& other) = delete;
+
+    /// delete copy assignment operator
+    FeedServer& operator=(const FeedServer& other) = delete;
+
+
+    /// destructor - stops the server
+    ~FeedServer();
+
+
+    /** \brief starts to listen for connections in a background thread
+     *
+     * \param address  IPv4 address to listen on, e.g. "127.0.0.1"
+     * \param port     TCP port to listen on, zero picks any free port
+     * \return Returns true, if the server was started.
+     *         Returns false, if an error occurred.
+     */
+    bool start(const std::string& address, const uint16_t port);
+
+
+    /** \brief gets the port the server listens on
+     *
+     * \return Returns the port. Returns zero, if the server is not running.
+     */
+    uint16_t port() const;
+
+
+    /** \brief stops the server and closes all connections
+     */
+    void stop();
+
+
+    /** \brief sets the feed that is served from now on
+     *
+     * \param feed  the serialised feed
+     * \return Returns true, if the feed was set.
+     *         Returns false, if it could not be compressed.
+     * \remarks Until the first feed is set, requests get the status
+     *          "503 Service Unavailable".
+     */
+    bool publish(const std::string& feed);
+  private:
+    /** \brief a version of the served feed */
+    struct Snapshot
+    {
+      std::string body; /**< the feed */
+      std::string gzipBody; /**< the feed, gzip-compressed */
+      std::string etag; /**< entity tag of the feed, including the quotes */
+      std::string gzipETag; /**< entity tag of the compressed feed, including the quotes */
+    }; //struct
+
+
+    /** \brief a response to a request */
+    struct Response
+    {
+      std::string head; /**< status line and headers, including the empty line */
+      std::shared_ptr<const Snapshot> snapshot; /**< keeps the body alive while it is sent */
+      const std::string* body; /**< body of the response, nullptr if there is none */
+    }; //struct
+
+
+    /** \brief accepts connections until the server is stopped */
+    void acceptLoop();
+
+
+    /** \brief handles all requests of a connection and closes it afterwards
+     *
+     * \param fd  the socket of the connection
+     */
+    void serveConnection(const int fd);
+
+
+    /** \brief creates the response to a request
+     *
+     * \param request    the request line and the headers of the request
+     * \param keepAlive  variable that will be set to whether the connection
+     *                   may be kept open after the response
+     * \return Returns the response. Its body is not copied but points into
+     *         the snapshot of the response.
+     */
+    Response respond(const std::string& request, bool& keepAlive) const;
+
+
+    std::shared_ptr<const Snapshot> m_Snapshot; /**< current feed, accessed atomically */
+    int m_Listener; /**< listening socket, -1 if the server is not running */
+    uint16_t m_Port; /**< port of the listening socket */
+    std::atomic<bool> m_Stop; /**< whether the server shall stop */
+    std::thread m_Acceptor; /**< thread that accepts connections */
+    std::mutex m_Mutex; /**< protects m_Connections */
+    std::condition_variable m_Closed; /**< signals that a connection was closed */
+    std::unordered_set<int> m_Connections; /**< sockets of open connections */
+}; //class
+
+#endif // FEEDSERVER_HPP
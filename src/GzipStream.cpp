@@ -0,0 +1,118 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the feed merger.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "GzipStream.hpp"
+#include <algorithm>
+
+bool GzipStream::compress(const std::string& data, std::string& compressed)
+{
+  compressed.clear();
+  GzipStream stream;
+  const bool success = stream.open([&compressed](const char* chunk, const std::size_t size)
+  {
+    compressed.append(chunk, size);
+    return true;
+  })
+      && stream.write(data.data(), data.size())
+      && stream.finish();
+  if (!success)
+    compressed.clear();
+  return success;
+}
+
+GzipStream::GzipStream()
+: m_Stream(z_stream()),
+  m_Open(false),
+  m_Sink(nullptr)
+{
+}
+
+GzipStream::~GzipStream()
+{
+  close();
+}
+
+bool GzipStream::open(Sink sink)
+{
+  close();
+  if (!sink)
+    return false;
+  m_Stream = z_stream();
+  //15 + 16 window bits: maximum window size, with a gzip header
+  if (deflateInit2(&m_Stream, Z_BEST_COMPRESSION, Z_DEFLATED, 15 + 16, 8,
+                   Z_DEFAULT_STRATEGY) != Z_OK)
+    return false;
+  m_Open = true;
+  m_Sink = std::move(sink);
+  return true;
+}
+
+bool GzipStream::write(const char* data, const std::size_t size)
+{
+  if (!m_Open)
+    return false;
+  //avail_in is only 32 bits wide, so large data is passed in several parts.
+  std::size_t offset = 0;
+  while (offset < size)
+  {
+    const std::size_t part = std::min<std::size_t>(size - offset, 1u << 30);
+    m_Stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data + offset));
+    m_Stream.avail_in = static_cast<uInt>(part);
+    if (!deflateToSink(Z_NO_FLUSH))
+      return false;
+    offset += part;
+  } //while
+  return true;
+}
+
+bool GzipStream::finish()
+{
+  if (!m_Open)
+    return false;
+  const bool success = deflateToSink(Z_FINISH);
+  close();
+  return success;
+}
+
+bool GzipStream::deflateToSink(const int flush)
+{
+  unsigned char chunk[16384];
+  do
+  {
+    m_Stream.next_out = chunk;
+    m_Stream.avail_out = sizeof(chunk);
+    if (deflate(&m_Stream, flush) == Z_STREAM_ERROR)
+      return false;
+    const std::size_t produced = sizeof(chunk) - m_Stream.avail_out;
+    if ((produced > 0) && !m_Sink(reinterpret_cast<const char*>(chunk), produced))
+      return false;
+  } while (m_Stream.avail_out == 0);
+  return true;
+}
+
+void GzipStream::close()
+{
+  if (m_Open)
+  {
+    deflateEnd(&m_Stream);
+    m_Open = false;
+  }
+  m_Sink = nullptr;
+}
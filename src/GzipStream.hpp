@@ -0,0 +1,116 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the feed merger.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef GZIPSTREAM_HPP
+#define GZIPSTREAM_HPP
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <zlib.h>
+
+/** \brief compresses data in the gzip format while it is produced
+ *
+ * The compressed data is handed to a sink function in chunks, so neither the
+ * uncompressed nor the compressed data has to be held in memory as a whole.
+ */
+class GzipStream
+{
+  public:
+    /** \brief type of the function that receives the compressed data
+     *
+     * The function gets a pointer to the data and its size in bytes. It has
+     * to return true, if the data was processed, or false to abort.
+     */
+    typedef std::function<bool(const char* data, const std::size_t size)> Sink;
+
+
+    /** \brief compresses a whole string in the gzip format
+     *
+     * \param data        the uncompressed data
+     * \param compressed  string that will receive the compressed data
+     * \return Returns true, if the data was compressed.
+     *         Returns false, if an error occurred.
+     */
+    static bool compress(const std::string& data, std::string& compressed);
+
+
+    ///default constructor
+    GzipStream();
+
+    /// delete copy constructor
+    GzipStream(const GzipStream& other) = delete;
+
+    /// delete copy assignment operator
+    GzipStream& operator=(const GzipStream& other) = delete;
+
+
+    /// destructor
+    ~GzipStream();
+
+
+    /** \brief starts a new compressed stream
+     *
+     * \param sink  function that receives the compressed data
+     * \return Returns true, if the stream could be started.
+     *         Returns false otherwise.
+     * \remarks A previously started stream is discarded.
+     */
+    bool open(Sink sink);
+
+
+    /** \brief compresses data and passes the result to the sink
+     *
+     * \param data  pointer to the uncompressed data
+     * \param size  size of the data in bytes
+     * \return Returns true, if the data was compressed and the sink accepted
+     *         the result. Returns false otherwise.
+     * \remarks The sink may not get any data until enough data has been
+     *          written or until finish() is called.
+     */
+    bool write(const char* data, const std::size_t size);
+
+
+    /** \brief compresses all remaining data and ends the stream
+     *
+     * \return Returns true, if the stream was ended successfully.
+     *         Returns false otherwise.
+     */
+    bool finish();
+  private:
+    /** \brief compresses the pending input and passes it to the sink
+     *
+     * \param flush  flush mode for deflate()
+     * \return Returns true, if the data was compressed and passed to the sink.
+     */
+    bool deflateToSink(const int flush);
+
+
+    /** \brief frees the compression state, if any
+     */
+    void close();
+
+
+    z_stream m_Stream; /**< deflate state */
+    bool m_Open; /**< whether m_Stream is initialized */
+    Sink m_Sink; /**< receives the compressed data */
+}; //class
+
+#endif // GZIPSTREAM_HPP
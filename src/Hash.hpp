@@ -0,0 +1,45 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the feed merger.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef HASH_HPP
+#define HASH_HPP
+
+#include <cstdint>
+#include <string>
+
+/** \brief calculates the 64 bit FNV-1a hash of a string
+ *
+ * \param data  the string
+ * \return Returns the hash value.
+ * \remarks The hash is stable across runs and platforms, so it can be used
+ *          for file names, too.
+ */
+inline std::uint64_t fnv1a(const std::string& data)
+{
+  std::uint64_t hash = 14695981039346656037ULL;
+  for (const char c : data)
+  {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+#endif // HASH_HPP
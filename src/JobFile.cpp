@@ -0,0 +1,226 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the feed merger.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "JobFile.hpp"
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <unordered_set>
+#include "rfc822/Date.hpp"
+#include "rss2.0/Channel.hpp"
+#include "StringFunctions.hpp"
+
+/* Removes leading and trailing whitespace. */
+static std::string trimmed(const std::string& text)
+{
+  const auto first = text.find_first_not_of(" \t\r");
+  if (first == std::string::npos)
+    return std::string();
+  const auto last = text.find_last_not_of(" \t\r");
+  return text.substr(first, last - first + 1);
+}
+
+/* Checks whether a parsed job has all required keys and reports missing
+   keys. */
+static bool isComplete(const JobFile::Job& job)
+{
+  if (job.output.empty())
+  {
+    std::cerr << "Error: Job " << job.name << " has no output file." << std::endl;
+    return false;
+  }
+  if (job.sources.empty())
+  {
+    std::cerr << "Error: Job " << job.name << " has no sources." << std::endl;
+    return false;
+  }
+  return true;
+}
+
+JobFile::Job::Job()
+: name(std::string()),
+  output(std::string()),
+  sources(std::vector<std::string>()),
+  maxItems(0),
+  since(RSS20::Channel::NoDate),
+  dedupKeys(std::vector<RSS20::Deduplicator::Key>()),
+  dedupPrefer(RSS20::Deduplicator::Prefer::Newest)
+{
+}
+
+bool JobFile::parse(const std::string& content, std::vector<Job>& jobs)
+{
+  std::vector<Job> parsed;
+  std::unordered_set<std::string> names;
+  std::unordered_set<std::string> outputs;
+  std::istringstream stream(content);
+  std::string line;
+  unsigned int lineNumber = 0;
+  while (std::getline(stream, line))
+  {
+    ++lineNumber;
+    line = trimmed(line);
+    if (line.empty() || (line[0] == '#') || (line[0] == ';'))
+      continue;
+    //start of a new job
+    if (line[0] == '[')
+    {
+      const std::string name = (line.back() == ']') ? trimmed(line.substr(1, line.size() - 2)) : std::string();
+      if (name.empty())
+      {
+        std::cerr << "Error: Invalid job name in line " << lineNumber
+                  << " of the job file." << std::endl;
+        return false;
+      }
+      if (!names.insert(name).second)
+      {
+        std::cerr << "Error: Job " << name << " is defined more than once." << std::endl;
+        return false;
+      }
+      if (!parsed.empty() && !isComplete(parsed.back()))
+        return false;
+      parsed.push_back(Job());
+      parsed.back().name = name;
+      continue;
+    } //if section
+
+    const auto equals = line.find('=');
+    if (equals == std::string::npos)
+    {
+      std::cerr << "Error: Line " << lineNumber << " of the job file is neither "
+                << "a job name nor of the form key = value." << std::endl;
+      return false;
+    }
+    if (parsed.empty())
+    {
+      std::cerr << "Error: Line " << lineNumber << " of the job file does not "
+                << "belong to any job. Start the job with its name in square "
+                << "brackets, e.g. [news]." << std::endl;
+      return false;
+    }
+    Job& job = parsed.back();
+    const std::string key = trimmed(line.substr(0, equals));
+    const std::string value = trimmed(line.substr(equals + 1));
+    if (value.empty())
+    {
+      std::cerr << "Error: Key " << key << " in line " << lineNumber
+                << " of the job file has no value." << std::endl;
+      return false;
+    }
+    if (key == "output")
+    {
+      if (!job.output.empty())
+      {
+        std::cerr << "Error: Job " << job.name << " has more than one output file." << std::endl;
+        return false;
+      }
+      if (!outputs.insert(value).second)
+      {
+        std::cerr << "Error: Output file " << value << " of job " << job.name
+                  << " is used by another job, too." << std::endl;
+        return false;
+      }
+      job.output = value;
+    }
+    else if (key == "source")
+    {
+      job.sources.push_back(value);
+    }
+    else if (key == "max-items")
+    {
+      int number = 0;
+      if (!stringToInt(value, number) || (number <= 0))
+      {
+        std::cerr << "Error: \"" << value << "\" in line " << lineNumber
+                  << " of the job file is not a valid number of items. "
+                  << "Expected a positive integer." << std::endl;
+        return false;
+      }
+      job.maxItems = static_cast<std::size_t>(number);
+    }
+    else if (key == "since")
+    {
+      if (!rfc822DateTimeToTimeT(value, job.since) || (job.since == RSS20::Channel::NoDate))
+      {
+        std::cerr << "Error: \"" << value << "\" in line " << lineNumber
+                  << " of the job file is not a valid date. Expected a date "
+                  << "like \"Sun, 01 Mar 2026 00:00:00 GMT\"." << std::endl;
+        return false;
+      }
+    }
+    else if (key == "dedup")
+    {
+      if (!RSS20::Deduplicator::keysFromString(value, job.dedupKeys))
+      {
+        std::cerr << "Error: \"" << value << "\" in line " << lineNumber
+                  << " of the job file is not a valid list of keys. Expected "
+                  << "a comma-separated list of guid, link and title." << std::endl;
+        return false;
+      }
+    }
+    else if (key == "dedup-prefer")
+    {
+      if (!RSS20::Deduplicator::preferFromString(value, job.dedupPrefer))
+      {
+        std::cerr << "Error: \"" << value << "\" in line " << lineNumber
+                  << " of the job file is not a valid copy. Expected newest "
+                  << "or first." << std::endl;
+        return false;
+      }
+      //Same as on the command line: a preference implies the default keys.
+      if (job.dedupKeys.empty())
+        job.dedupKeys = RSS20::Deduplicator().keys();
+    }
+    else
+    {
+      std::cerr << "Error: Unknown key " << key << " in line " << lineNumber
+                << " of the job file." << std::endl;
+      return false;
+    }
+  } //while
+
+  if (parsed.empty())
+  {
+    std::cerr << "Error: The job file does not contain any jobs." << std::endl;
+    return false;
+  }
+  if (!isComplete(parsed.back()))
+    return false;
+  jobs = std::move(parsed);
+  return true;
+}
+
+bool JobFile::fromFile(const std::string& fileName, std::vector<Job>& jobs)
+{
+  std::ifstream stream(fileName, std::ios::in | std::ios::binary);
+  if (!stream.good())
+  {
+    std::cerr << "Error: Could not open job file " << fileName << "!" << std::endl;
+    return false;
+  }
+  std::ostringstream buffer;
+  buffer << stream.rdbuf();
+  if (stream.bad())
+  {
+    std::cerr << "Error: Could not read job file " << fileName << "!" << std::endl;
+    return false;
+  }
+  return parse(buffer.str(), jobs);
+}
@@ -0,0 +1,90 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the feed merger.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef JOBFILE_HPP
+#define JOBFILE_HPP
+
+#include <ctime>
+#include <string>
+#include <vector>
+#include "rss2.0/Deduplicator.hpp"
+
+/** \brief reads job files that describe several merged feeds at once
+ *
+ * A job file has one section per merged feed. The section starts with the
+ * name of the job in square brackets, followed by lines of the form
+ * "key = value":
+ *
+ *     [news]
+ *     output = news.xml
+ *     source = https://example.com/feed.xml
+ *     source = archive/old-news.xml
+ *     max-items = 50
+ *     since = Sun, 01 Mar 2026 00:00:00 GMT
+ *     dedup = guid,link
+ *     dedup-prefer = first
+ *
+ * "output" and at least one "source" are required, the other keys are
+ * optional; "dedup-prefer" without "dedup" uses the default keys. Sources
+ * are URLs or paths of local feed files or directories.
+ * Empty lines and lines starting with '#' or ';' are ignored.
+ */
+class JobFile
+{
+  public:
+    /** \brief a single merged feed of a job file
+     */
+    struct Job
+    {
+      /** default constructor */
+      Job();
+
+      std::string name;   /**< name of the job */
+      std::string output; /**< file name of the merged feed */
+      std::vector<std::string> sources; /**< URLs and paths of the feeds */
+      std::size_t maxItems; /**< maximum number of items, zero means no limit */
+      std::time_t since;  /**< oldest publication date of items, or NoDate */
+      std::vector<RSS20::Deduplicator::Key> dedupKeys; /**< keys for duplicates, empty means no removal */
+      RSS20::Deduplicator::Prefer dedupPrefer; /**< which copy of duplicates is kept */
+    }; //struct
+
+
+    /** \brief parses the content of a job file
+     *
+     * \param content  the content of the job file
+     * \param jobs     variable that will be used to store the jobs
+     * \return Returns true, if the content is a valid job file.
+     *         Returns false otherwise.
+     * \remarks Errors are reported on the standard error stream.
+     */
+    static bool parse(const std::string& content, std::vector<Job>& jobs);
+
+
+    /** \brief reads a job file
+     *
+     * \param fileName  name of the job file
+     * \param jobs      variable that will be used to store the jobs
+     * \return Returns true, if the file could be read and is a valid job file.
+     *         Returns false otherwise.
+     */
+    static bool fromFile(const std::string& fileName, std::vector<Job>& jobs);
+}; //class
+
+#endif // JOBFILE_HPP
@@ -0,0 +1,106 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the feed merger.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "MappedFile.hpp"
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+MappedFile::MappedFile()
+: m_Data(nullptr),
+  m_Size(0)
+{
+}
+
+MappedFile::~MappedFile()
+{
+  close();
+}
+
+bool MappedFile::open(const std::string& fileName)
+{
+  close();
+  const int fd = ::open(fileName.c_str(), O_RDONLY);
+  if (fd == -1)
+  {
+    std::cerr << "Error: Could not open file " << fileName << ": "
+              << std::strerror(errno) << std::endl;
+    return false;
+  }
+  struct stat info;
+  if (fstat(fd, &info) != 0)
+  {
+    std::cerr << "Error: Could not get size of file " << fileName << ": "
+              << std::strerror(errno) << std::endl;
+    ::close(fd);
+    return false;
+  }
+  //Empty files cannot be mapped, and there is nothing to parse anyway.
+  if (info.st_size <= 0)
+  {
+    std::cerr << "Error: File " << fileName << " is empty!" << std::endl;
+    ::close(fd);
+    return false;
+  }
+  const std::size_t size = static_cast<std::size_t>(info.st_size);
+  void * data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  //The mapping stays valid after the file descriptor is closed.
+  ::close(fd);
+  if (data == MAP_FAILED)
+  {
+    std::cerr << "Error: Could not map file " << fileName << " into memory: "
+              << std::strerror(errno) << std::endl;
+    return false;
+  }
+  //Parsers read the data from start to end.
+  madvise(data, size, MADV_SEQUENTIAL);
+  m_Data = data;
+  m_Size = size;
+  return true;
+}
+
+void MappedFile::close()
+{
+  if (m_Data != nullptr)
+  {
+    munmap(m_Data, m_Size);
+    m_Data = nullptr;
+    m_Size = 0;
+  }
+}
+
+bool MappedFile::isOpen() const
+{
+  return (m_Data != nullptr);
+}
+
+const char* MappedFile::data() const
+{
+  return static_cast<const char*>(m_Data);
+}
+
+std::size_t MappedFile::size() const
+{
+  return m_Size;
+}
@@ -0,0 +1,91 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the feed merger.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef MAPPEDFILE_HPP
+#define MAPPEDFILE_HPP
+
+#include <cstddef>
+#include <string>
+
+/** \brief read-only view of a file that is mapped into memory
+ *
+ * The file's content is not copied into a buffer. Pages are loaded by the
+ * operating system when they are accessed, so the data can be handed to a
+ * parser in place.
+ */
+class MappedFile
+{
+  public:
+    ///default constructor
+    MappedFile();
+
+    /// delete copy constructor
+    MappedFile(const MappedFile& other) = delete;
+
+    /// delete copy assignment operator
+    MappedFile& operator=(const MappedFile& other) = delete;
+
+
+    /// destructor - unmaps the file
+    ~MappedFile();
+
+
+    /** \brief maps the given file into memory
+     *
+     * \param fileName  path of the file
+     * \return Returns true, if the file was mapped.
+     *         Returns false, if the file could not be opened or mapped.
+     * \remarks A previously mapped file is unmapped first.
+     */
+    bool open(const std::string& fileName);
+
+
+    /** \brief unmaps the currently mapped file, if any
+     */
+    void close();
+
+
+    /** \brief checks whether a file is mapped
+     *
+     * \return Returns true, if a file is mapped.
+     */
+    bool isOpen() const;
+
+
+    /** \brief gets the content of the mapped file
+     *
+     * \return Returns a pointer to the first byte of the file.
+     *         Returns nullptr, if no file is mapped.
+     * \remarks The content is not NUL-terminated. Use size() to get its length.
+     */
+    const char* data() const;
+
+
+    /** \brief gets the size of the mapped file
+     *
+     * \return Returns the size of the file in bytes.
+     */
+    std::size_t size() const;
+  private:
+    void* m_Data; /**< start of the mapping, nullptr if no file is mapped */
+    std::size_t m_Size; /**< length of the mapping in bytes */
+}; //class
+
+#endif // MAPPEDFILE_HPP
@@ -0,0 +1,87 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the feed merger.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "Parallel.hpp"
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+unsigned int hardwareThreads()
+{
+  const unsigned int threads = std::thread::hardware_concurrency();
+  return (threads > 0) ? threads : 1;
+}
+
+void parallelFor(const std::size_t count, unsigned int threads,
+                 const std::function<void(std::size_t)>& task)
+{
+  if (threads == 0)
+    threads = hardwareThreads();
+  if (threads > count)
+    threads = static_cast<unsigned int>(count);
+  //No need to start threads for a single task.
+  if (threads <= 1)
+  {
+    for (std::size_t idx = 0; idx < count; ++idx)
+    {
+      task(idx);
+    } //for
+    return;
+  }
+
+  //Threads take the next index until all indices are taken.
+  std::atomic<std::size_t> next(0);
+  std::exception_ptr firstError = nullptr;
+  std::mutex errorMutex;
+  const auto worker = [&]()
+  {
+    std::size_t idx;
+    while ((idx = next.fetch_add(1)) < count)
+    {
+      try
+      {
+        task(idx);
+      }
+      catch (...)
+      {
+        const std::lock_guard<std::mutex> lock(errorMutex);
+        if (firstError == nullptr)
+          firstError = std::current_exception();
+      }
+    } //while
+  };
+
+  std::vector<std::thread> pool;
+  pool.reserve(threads - 1);
+  for (unsigned int i = 1; i < threads; ++i)
+  {
+    pool.emplace_back(worker);
+  } //for
+  //The calling thread does its share of the work, too.
+  worker();
+  for (auto& thread : pool)
+  {
+    thread.join();
+  } //for
+  if (firstError != nullptr)
+    std::rethrow_exception(firstError);
+}
@@ -0,0 +1,48 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the feed merger.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef PARALLEL_HPP
+#define PARALLEL_HPP
+
+#include <cstddef>
+#include <functional>
+
+/** \brief gets the number of threads that can run at the same time
+ *
+ * \return Returns the number of hardware threads, or one, if that number is
+ *         not known.
+ */
+unsigned int hardwareThreads();
+
+
+/** \brief runs a task for each index from zero to count-1 on several threads
+ *
+ * \param count    number of indices
+ * \param threads  maximum number of threads to use, zero means hardwareThreads()
+ * \param task     the task that is run once for each index
+ * \remarks Calls for different indices may run at the same time, so a task
+ *          must only modify data that belongs to its own index. The function
+ *          returns after all tasks are done. If a task throws, the first
+ *          exception is rethrown after all threads have finished.
+ */
+void parallelFor(const std::size_t count, unsigned int threads,
+                 const std::function<void(std::size_t)>& task);
+
+#endif // PARALLEL_HPP
@@ -0,0 +1,100 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the feed merger.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "RefreshScheduler.hpp"
+#include <algorithm>
+
+RefreshScheduler::RefreshScheduler(const std::size_t sources, const unsigned int interval)
+: m_Refresh(std::vector<std::time_t>(sources, 0)),
+  m_Interval(interval)
+{
+}
+
+std::vector<std::size_t> RefreshScheduler::due(const std::time_t now) const
+{
+  std::vector<std::size_t> result;
+  for (std::size_t idx = 0; idx < m_Refresh.size(); ++idx)
+  {
+    if (m_Refresh[idx] <= now)
+      result.push_back(idx);
+  } //for
+  return result;
+}
+
+std::time_t RefreshScheduler::nextRefresh() const
+{
+  if (m_Refresh.empty())
+    return 0;
+  return *std::min_element(m_Refresh.begin(), m_Refresh.end());
+}
+
+std::time_t RefreshScheduler::refreshTime(const std::size_t source) const
+{
+  return m_Refresh.at(source);
+}
+
+void RefreshScheduler::refreshed(const std::size_t source, const RSS20::Channel& feed, const std::time_t now)
+{
+  //ttl is the number of minutes the feed may be cached before a refresh.
+  std::time_t interval = m_Interval;
+  if (feed.ttl() > 0)
+    interval = std::max(interval, static_cast<std::time_t>(feed.ttl()) * 60);
+  m_Refresh.at(source) = firstAllowedTime(feed, now + interval);
+}
+
+void RefreshScheduler::failed(const std::size_t source, const std::time_t now)
+{
+  m_Refresh.at(source) = now + m_Interval;
+}
+
+std::time_t RefreshScheduler::firstAllowedTime(const RSS20::Channel& feed, const std::time_t earliest)
+{
+  const auto& hours = feed.skipHours();
+  const auto& days = feed.skipDays();
+  //A feed that never wants to be refreshed is probably misconfigured.
+  if ((hours.size() >= 24) || (days.size() >= 7))
+    return earliest;
+  std::time_t candidate = earliest;
+  //Every step passes at least one skipped hour, so a week is enough.
+  for (unsigned int step = 0; step < 7 * 24; ++step)
+  {
+    struct tm parts;
+    if (gmtime_r(&candidate, &parts) == nullptr)
+      return earliest;
+    //tm_wday counts from Sunday, Days starts with Monday.
+    const BasicRSS::Days day = (parts.tm_wday == 0) ? BasicRSS::Days::Sunday
+                             : static_cast<BasicRSS::Days>(parts.tm_wday - 1);
+    const std::time_t secondsIntoHour = parts.tm_min * 60 + parts.tm_sec;
+    if (days.find(day) != days.end())
+    {
+      //continue at the start of the next day
+      candidate += 86400 - parts.tm_hour * 3600 - secondsIntoHour;
+      continue;
+    }
+    if (hours.find(static_cast<unsigned int>(parts.tm_hour)) != hours.end())
+    {
+      //continue at the start of the next hour
+      candidate += 3600 - secondsIntoHour;
+      continue;
+    }
+    return candidate;
+  } //for
+  return candidate;
+}
@@ -0,0 +1,105 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the feed merger.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef REFRESHSCHEDULER_HPP
+#define REFRESHSCHEDULER_HPP
+
+#include <cstddef>
+#include <ctime>
+#include <vector>
+#include "rss2.0/Channel.hpp"
+
+/** \brief keeps track of when the sources of the merged feed are refreshed
+ *
+ * Every source is refreshed after a default interval, or after the time to
+ * live (ttl) of its feed, if that is longer. Hours and days that the feed
+ * lists in its skipHours and skipDays elements are skipped.
+ */
+class RefreshScheduler
+{
+  public:
+    /** \brief constructor
+     *
+     * \param sources   number of sources
+     * \param interval  default refresh interval in seconds
+     * \remarks All sources are due immediately.
+     */
+    RefreshScheduler(const std::size_t sources, const unsigned int interval);
+
+
+    /** \brief gets the sources that are due for a refresh
+     *
+     * \param now  the current time
+     * \return Returns the indices of all sources that have to be refreshed
+     *         at or before the given time, in ascending order.
+     */
+    std::vector<std::size_t> due(const std::time_t now) const;
+
+
+    /** \brief gets the time of the next refresh of any source
+     *
+     * \return Returns the earliest refresh time of all sources.
+     *         Returns zero, if there are no sources.
+     */
+    std::time_t nextRefresh() const;
+
+
+    /** \brief gets the time of the next refresh of a source
+     *
+     * \param source  index of the source
+     * \return Returns the time of the next refresh of the source.
+     */
+    std::time_t refreshTime(const std::size_t source) const;
+
+
+    /** \brief schedules the next refresh of a source after it was refreshed
+     *
+     * \param source  index of the source
+     * \param feed    the current feed of the source
+     * \param now     time of the refresh
+     */
+    void refreshed(const std::size_t source, const RSS20::Channel& feed, const std::time_t now);
+
+
+    /** \brief schedules the next refresh of a source after its refresh failed
+     *
+     * \param source  index of the source
+     * \param now     time of the failed refresh
+     * \remarks The refresh is retried after the default interval.
+     */
+    void failed(const std::size_t source, const std::time_t now);
+
+
+    /** \brief gets the first time at or after a given time when a feed may be
+     *         refreshed according to its skipHours and skipDays elements
+     *
+     * \param feed      the feed
+     * \param earliest  the earliest time for the refresh
+     * \return Returns the first time that is not in one of the skipped hours
+     *         or days (GMT). If the feed skips all hours or all days, then
+     *         the elements are ignored and earliest is returned.
+     */
+    static std::time_t firstAllowedTime(const RSS20::Channel& feed, const std::time_t earliest);
+  private:
+    std::vector<std::time_t> m_Refresh; /**< next refresh time of each source */
+    unsigned int m_Interval; /**< default refresh interval in seconds */
+}; //class
+
+#endif // REFRESHSCHEDULER_HPP
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the feed merger.
-    Copyright (C) 2015  Dirk Stolle
+    Copyright (C) 2015, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -29,7 +29,7 @@ namespace Atom10
 bool Parser::categoryFromNode(const XMLNode& categoryNode, Category& categoryInfo)
 {
   if (!categoryNode.isElementNode()
-      or (categoryNode.getNameAsString() != "category"))
+      or (categoryNode.getElementName() != ElementName::Category))
     return false;
 
   const auto attributes = categoryNode.getAttributes();
@@ -85,7 +85,7 @@ bool Parser::categoryFromNode(const XMLNode& categoryNode, Category& categoryInf
 
 bool Parser::linkFromNode(const XMLNode& linkNode, Link& linkInfo)
 {
-  if (!linkNode.isElementNode() or (linkNode.getNameAsString() != "link"))
+  if (!linkNode.isElementNode() or (linkNode.getElementName() != ElementName::Link))
     return false;
 
   //link should not have any child nodes
@@ -182,7 +182,8 @@ bool Parser::linkFromNode(const XMLNode& linkNode, Link& linkInfo)
 
 bool Parser::personConstructFromNode(const XMLNode& personConstructNode, PersonConstruct& personInfo, const std::string& nodeName)
 {
-  if (!personConstructNode.isElementNode() or (personConstructNode.getNameAsString() != nodeName))
+  if (!personConstructNode.isElementNode()
+      or (nodeName != reinterpret_cast<const char*>(personConstructNode.getName())))
     return false;
 
   if (!personConstructNode.hasChild())
@@ -192,9 +193,12 @@ bool Parser::personConstructFromNode(const XMLNode& personConstructNode, PersonC
 
   personInfo = PersonConstruct();
 
-  while (child.hasNextSibling())
+  while (true)
   {
     child.skipEmptyCommentAndTextSiblings();
+    //Only comments or whitespace may follow the last element.
+    if (child.isCommentNode() || child.isBlankTextNode())
+      break;
 
     if (!child.isElementNode())
     {
@@ -203,8 +207,8 @@ bool Parser::personConstructFromNode(const XMLNode& personConstructNode, PersonC
       return false;
     }
 
-    const std::string nodeName = child.getNameAsString();
-    if (nodeName == "name")
+    const ElementName name = child.getElementName();
+    if (name == ElementName::Name)
     {
       if (!personInfo.name().empty())
       {
@@ -213,7 +217,7 @@ bool Parser::personConstructFromNode(const XMLNode& personConstructNode, PersonC
       } //if name was already specified
       personInfo.setName(child.getContentBoth());
     }
-    else if (nodeName == "uri")
+    else if (name == ElementName::Uri)
     {
       if (!personInfo.uri().empty())
       {
@@ -222,7 +226,7 @@ bool Parser::personConstructFromNode(const XMLNode& personConstructNode, PersonC
       } //if URI was already specified
       personInfo.setUri(child.getContentBoth());
     }
-    else if (nodeName == "email")
+    else if (name == ElementName::Email)
     {
       if (!personInfo.email().empty())
       {
@@ -233,10 +237,12 @@ bool Parser::personConstructFromNode(const XMLNode& personConstructNode, PersonC
     }
     else
     {
-      std::cout << "Found unexpected node name within person construct: \"" << nodeName
+      std::cout << "Found unexpected node name within person construct: \"" << child.getNameAsString()
                 << "\"!" << std::endl;
       return false;
     }
+    if (!child.hasNextSibling())
+      break;
     child = child.getNextSibling();
   } //while
   //We are done here. Person construct should not be empty by now.
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the feed merger.
-    Copyright (C) 2015, 2017  Dirk Stolle
+    Copyright (C) 2015, 2017, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -29,7 +29,7 @@ namespace BasicRSS
 
 bool Parser::imageFromNode(const XMLNode& imageNode, Image& imageInfo)
 {
-  if (!imageNode.isElementNode() or (imageNode.getNameAsString() != "image"))
+  if (!imageNode.isElementNode() or (imageNode.getElementName() != ElementName::Image))
     return false;
 
   if (!imageNode.hasChild())
@@ -39,9 +39,12 @@ bool Parser::imageFromNode(const XMLNode& imageNode, Image& imageInfo)
 
   imageInfo = Image();
 
-  while (child.hasNextSibling())
+  while (true)
   {
     child.skipEmptyCommentAndTextSiblings();
+    //Only comments or whitespace may follow the last element.
+    if (child.isCommentNode() || child.isBlankTextNode())
+      break;
 
     if (!child.isElementNode())
     {
@@ -50,8 +53,8 @@ bool Parser::imageFromNode(const XMLNode& imageNode, Image& imageInfo)
       return false;
     }
 
-    const std::string nodeName = child.getNameAsString();
-    if (nodeName == "url")
+    const ElementName name = child.getElementName();
+    if (name == ElementName::Url)
     {
       if (!imageInfo.url().empty())
       {
@@ -60,7 +63,7 @@ bool Parser::imageFromNode(const XMLNode& imageNode, Image& imageInfo)
       } //if URL was already specified
       imageInfo.setUrl(child.getContentBoth());
     }
-    else if (nodeName == "title")
+    else if (name == ElementName::Title)
     {
       if (!imageInfo.title().empty())
       {
@@ -69,7 +72,7 @@ bool Parser::imageFromNode(const XMLNode& imageNode, Image& imageInfo)
       } //if title was already specified
       imageInfo.setTitle(child.getContentBoth());
     }
-    else if (nodeName == "link")
+    else if (name == ElementName::Link)
     {
       if (!imageInfo.link().empty())
       {
@@ -78,7 +81,7 @@ bool Parser::imageFromNode(const XMLNode& imageNode, Image& imageInfo)
       } //if link was already specified
       imageInfo.setLink(child.getContentBoth());
     }
-    else if (nodeName == "width")
+    else if (name == ElementName::Width)
     {
       if (imageInfo.width().has_value())
       {
@@ -100,7 +103,7 @@ bool Parser::imageFromNode(const XMLNode& imageNode, Image& imageInfo)
       }
       imageInfo.setWidth(tempInt);
     }
-    else if (nodeName == "height")
+    else if (name == ElementName::Height)
     {
       if (imageInfo.height().has_value())
       {
@@ -122,7 +125,7 @@ bool Parser::imageFromNode(const XMLNode& imageNode, Image& imageInfo)
       }
       imageInfo.setHeight(tempInt);
     }
-    else if (nodeName == "description")
+    else if (name == ElementName::Description)
     {
       if (!imageInfo.description().empty())
       {
@@ -133,10 +136,12 @@ bool Parser::imageFromNode(const XMLNode& imageNode, Image& imageInfo)
     }
     else
     {
-      std::cerr << "Found unexpected node name within image: \"" << nodeName
+      std::cerr << "Found unexpected node name within image: \"" << child.getNameAsString()
                 << "\"!" << std::endl;
       return false;
     }
+    if (!child.hasNextSibling())
+      break;
     child = child.getNextSibling();
   } //while
   //We are done here. Image should not be empty by now.
@@ -147,9 +152,9 @@ bool Parser::textInputFromNode(const XMLNode& textInputNode, TextInput& textInpu
 {
   if (!textInputNode.isElementNode()
       //upper-case i in element name for RSS 2.0
-      || ((textInputNode.getNameAsString() != "textInput") && !rss091)
+      || ((textInputNode.getElementName() != ElementName::TextInput) && !rss091)
       //lower-case i in element name for RSS 2.0
-      || ((textInputNode.getNameAsString() != "textinput") && rss091))
+      || ((textInputNode.getElementName() != ElementName::TextInputLowercase) && rss091))
     return false;
 
   if (!textInputNode.hasChild())
@@ -159,9 +164,12 @@ bool Parser::textInputFromNode(const XMLNode& textInputNode, TextInput& textInpu
 
   textInputInfo = TextInput();
 
-  while (child.hasNextSibling())
+  while (true)
   {
     child.skipEmptyCommentAndTextSiblings();
+    //Only comments or whitespace may follow the last element.
+    if (child.isCommentNode() || child.isBlankTextNode())
+      break;
 
     if (!child.isElementNode())
     {
@@ -170,8 +178,8 @@ bool Parser::textInputFromNode(const XMLNode& textInputNode, TextInput& textInpu
       return false;
     }
 
-    const std::string nodeName = child.getNameAsString();
-    if (nodeName == "title")
+    const ElementName name = child.getElementName();
+    if (name == ElementName::Title)
     {
       if (!textInputInfo.title().empty())
       {
@@ -180,7 +188,7 @@ bool Parser::textInputFromNode(const XMLNode& textInputNode, TextInput& textInpu
       } //if title was already specified
       textInputInfo.setTitle(child.getContentBoth());
     }
-    else if (nodeName == "description")
+    else if (name == ElementName::Description)
     {
       if (!textInputInfo.description().empty())
       {
@@ -189,7 +197,7 @@ bool Parser::textInputFromNode(const XMLNode& textInputNode, TextInput& textInpu
       } //if description was already specified
       textInputInfo.setDescription(child.getContentBoth());
     }
-    else if (nodeName == "name")
+    else if (name == ElementName::Name)
     {
       if (!textInputInfo.name().empty())
       {
@@ -198,7 +206,7 @@ bool Parser::textInputFromNode(const XMLNode& textInputNode, TextInput& textInpu
       } //if name was already specified
       textInputInfo.setName(child.getContentBoth());
     }
-    else if (nodeName == "link")
+    else if (name == ElementName::Link)
     {
       if (!textInputInfo.link().empty())
       {
@@ -209,10 +217,12 @@ bool Parser::textInputFromNode(const XMLNode& textInputNode, TextInput& textInpu
     }
     else
     {
-      std::cerr << "Found unexpected node name within textInput: \"" << nodeName
+      std::cerr << "Found unexpected node name within textInput: \"" << child.getNameAsString()
                 << "\"!" << std::endl;
       return false;
     }
+    if (!child.hasNextSibling())
+      break;
     child = child.getNextSibling();
   } //while
   //We are done here. Text input box should not be empty by now.
@@ -221,7 +231,7 @@ bool Parser::textInputFromNode(const XMLNode& textInputNode, TextInput& textInpu
 
 bool Parser::skipHoursFromNode(const XMLNode& skipHoursNode, std::set<unsigned int>& skipHoursInfo)
 {
-  if (!skipHoursNode.isElementNode() or (skipHoursNode.getNameAsString() != "skipHours"))
+  if (!skipHoursNode.isElementNode() or (skipHoursNode.getElementName() != ElementName::SkipHours))
     return false;
 
   if (!skipHoursNode.hasChild())
@@ -231,9 +241,12 @@ bool Parser::skipHoursFromNode(const XMLNode& skipHoursNode, std::set<unsigned i
 
   skipHoursInfo = std::set<unsigned int>();
 
-  while (child.hasNextSibling())
+  while (true)
   {
     child.skipEmptyCommentAndTextSiblings();
+    //Only comments or whitespace may follow the last element.
+    if (child.isCommentNode() || child.isBlankTextNode())
+      break;
 
     if (!child.isElementNode())
     {
@@ -242,9 +255,9 @@ bool Parser::skipHoursFromNode(const XMLNode& skipHoursNode, std::set<unsigned i
       return false;
     }
 
-    const std::string nodeName = child.getNameAsString();
+    const ElementName name = child.getElementName();
 
-    if (nodeName == "hour")
+    if (name == ElementName::Hour)
     {
       unsigned int hour = 25;
       if (!stringToUnsignedInt(child.getContentBoth(), hour))
@@ -273,10 +286,12 @@ bool Parser::skipHoursFromNode(const XMLNode& skipHoursNode, std::set<unsigned i
     }
     else
     {
-      std::cerr << "Found unexpected node name within skipHours: \"" << nodeName
+      std::cerr << "Found unexpected node name within skipHours: \"" << child.getNameAsString()
                 << "\"!" << std::endl;
       return false;
     }
+    if (!child.hasNextSibling())
+      break;
     child = child.getNextSibling();
   } //while
   //We are done here. Set should not be empty by now.
@@ -285,7 +300,7 @@ bool Parser::skipHoursFromNode(const XMLNode& skipHoursNode, std::set<unsigned i
 
 bool Parser::skipDaysFromNode(const XMLNode& skipDaysNode, std::set<Days>& skipDaysInfo)
 {
-  if (!skipDaysNode.isElementNode() or (skipDaysNode.getNameAsString() != "skipDays"))
+  if (!skipDaysNode.isElementNode() or (skipDaysNode.getElementName() != ElementName::SkipDays))
     return false;
 
   if (!skipDaysNode.hasChild())
@@ -295,9 +310,12 @@ bool Parser::skipDaysFromNode(const XMLNode& skipDaysNode, std::set<Days>& skipD
 
   skipDaysInfo = std::set<Days>();
 
-  while (child.hasNextSibling())
+  while (true)
   {
     child.skipEmptyCommentAndTextSiblings();
+    //Only comments or whitespace may follow the last element.
+    if (child.isCommentNode() || child.isBlankTextNode())
+      break;
 
     if (!child.isElementNode())
     {
@@ -306,9 +324,9 @@ bool Parser::skipDaysFromNode(const XMLNode& skipDaysNode, std::set<Days>& skipD
       return false;
     }
 
-    const std::string nodeName = child.getNameAsString();
+    const ElementName name = child.getElementName();
 
-    if (nodeName == "day")
+    if (name == ElementName::Day)
     {
       Days day = Days::Monday;
       const std::string strDay = child.getContentBoth();
@@ -343,10 +361,12 @@ bool Parser::skipDaysFromNode(const XMLNode& skipDaysNode, std::set<Days>& skipD
     }
     else
     {
-      std::cerr << "Found unexpected node name within skipDays: \"" << nodeName
+      std::cerr << "Found unexpected node name within skipDays: \"" << child.getNameAsString()
                 << "\"!" << std::endl;
       return false;
     }
+    if (!child.hasNextSibling())
+      break;
     child = child.getNextSibling();
   } //while
   //We are done here. Set should not be empty by now.
@@ -356,8 +376,8 @@ bool Parser::skipDaysFromNode(const XMLNode& skipDaysNode, std::set<Days>& skipD
 bool Parser::commonChannelElementFromNode(const XMLNode& node, Channel& feed, bool& errorFlag)
 {
   errorFlag = false;
-  const std::string nodeName = node.getNameAsString();
-  if (nodeName == "title")
+  const ElementName name = node.getElementName();
+  if (name == ElementName::Title)
   {
     if (!feed.title().empty())
     {
@@ -367,7 +387,7 @@ bool Parser::commonChannelElementFromNode(const XMLNode& node, Channel& feed, bo
     } //if title was already specified
     feed.setTitle(node.getContentBoth());
   } //if title
-  else if (nodeName == "link")
+  else if (name == ElementName::Link)
   {
     if (!feed.link().empty())
     {
@@ -377,7 +397,7 @@ bool Parser::commonChannelElementFromNode(const XMLNode& node, Channel& feed, bo
     } //if link was already specified
     feed.setLink(node.getContentBoth());
   } //if link
-  else if (nodeName == "description")
+  else if (name == ElementName::Description)
   {
     if (!feed.description().empty())
     {
@@ -387,7 +407,7 @@ bool Parser::commonChannelElementFromNode(const XMLNode& node, Channel& feed, bo
     } //if description was already specified
     feed.setDescription(node.getContentBoth());
   } //if description
-  else if (nodeName == "language")
+  else if (name == ElementName::Language)
   {
     if (!feed.language().empty())
     {
@@ -397,7 +417,7 @@ bool Parser::commonChannelElementFromNode(const XMLNode& node, Channel& feed, bo
     } //if language was already specified
     feed.setLanguage(node.getContentBoth());
   } //if language
-  else if (nodeName == "copyright")
+  else if (name == ElementName::Copyright)
   {
     if (!feed.copyright().empty())
     {
@@ -407,7 +427,7 @@ bool Parser::commonChannelElementFromNode(const XMLNode& node, Channel& feed, bo
     } //if copyright notice was already specified
     feed.setCopyright(node.getContentBoth());
   } //if copyright
-  else if (nodeName == "managingEditor")
+  else if (name == ElementName::ManagingEditor)
   {
     if (!feed.managingEditor().empty())
     {
@@ -417,7 +437,7 @@ bool Parser::commonChannelElementFromNode(const XMLNode& node, Channel& feed, bo
     } //if address was already specified
     feed.setManagingEditor(node.getContentBoth());
   } //if
-  else if (nodeName == "webMaster")
+  else if (name == ElementName::WebMaster)
   {
     if (!feed.webMaster().empty())
     {
@@ -427,7 +447,7 @@ bool Parser::commonChannelElementFromNode(const XMLNode& node, Channel& feed, bo
     } //if address was already specified
     feed.setWebMaster(node.getContentBoth());
   } //if webMaster
-  else if (nodeName == "pubDate")
+  else if (name == ElementName::PubDate)
   {
     if (feed.pubDate() != 0)
     {
@@ -445,7 +465,7 @@ bool Parser::commonChannelElementFromNode(const XMLNode& node, Channel& feed, bo
     }
     feed.setPubDate(thePubDate);
   } //if pubDate
-  else if (nodeName == "lastBuildDate")
+  else if (name == ElementName::LastBuildDate)
   {
     if (feed.lastBuildDate() != 0)
     {
@@ -463,7 +483,7 @@ bool Parser::commonChannelElementFromNode(const XMLNode& node, Channel& feed, bo
     }
     feed.setLastBuildDate(theLastBuildDate);
   } //if lastBuildDate
-  else if (nodeName == "docs")
+  else if (name == ElementName::Docs)
   {
     if (!feed.docs().empty())
     {
@@ -473,7 +493,7 @@ bool Parser::commonChannelElementFromNode(const XMLNode& node, Channel& feed, bo
     } //if documentation URL was already specified
     feed.setDocs(node.getContentBoth());
   } //if docs
-  else if (nodeName == "image")
+  else if (name == ElementName::Image)
   {
     if (!feed.image().empty())
     {
@@ -490,7 +510,7 @@ bool Parser::commonChannelElementFromNode(const XMLNode& node, Channel& feed, bo
     }
     feed.setImage(std::move(img));
   } //if image
-  else if (nodeName == "rating")
+  else if (name == ElementName::Rating)
   {
     if (!feed.rating().empty())
     {
@@ -500,7 +520,7 @@ bool Parser::commonChannelElementFromNode(const XMLNode& node, Channel& feed, bo
     } //if rating was already specified
     feed.setRating(node.getContentBoth());
   } //if rating
-  else if (nodeName == "skipHours")
+  else if (name == ElementName::SkipHours)
   {
     if (!feed.skipHours().empty())
     {
@@ -517,7 +537,7 @@ bool Parser::commonChannelElementFromNode(const XMLNode& node, Channel& feed, bo
     }
     feed.setSkipHours(std::move(skipH));
   } //if skipHours
-  else if (nodeName == "skipDays")
+  else if (name == ElementName::SkipDays)
   {
     if (!feed.skipDays().empty())
     {
@@ -0,0 +1,264 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the feed merger.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "FetchCache.hpp"
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include "../AtomicFile.hpp"
+#include "../Hash.hpp"
+
+//first line of every cache file, changes when the file format changes
+const std::string cCacheFileSignature = "feed-merger fetch cache v1";
+
+//first line of every merge record, changes when the file format changes
+const std::string cMergeRecordSignature = "feed-merger merge record v1";
+
+FetchCache::Entry::Entry()
+: url(""),
+  etag(""),
+  lastModified(""),
+  body("")
+{
+}
+
+FetchCache::FetchCache(const std::string& directory)
+: m_Directory(directory)
+{
+}
+
+const std::string& FetchCache::directory() const
+{
+  return m_Directory;
+}
+
+bool FetchCache::create() const
+{
+  std::error_code error;
+  if (std::filesystem::is_directory(m_Directory, error))
+    return true;
+  if (!std::filesystem::create_directories(m_Directory, error))
+  {
+    std::cerr << "Error: Could not create cache directory " << m_Directory
+              << ". " << error.message() << std::endl;
+    return false;
+  }
+  return true;
+}
+
+std::string FetchCache::fileName(const std::string& url, const std::string& extension) const
+{
+  const char hexDigits[] = "0123456789abcdef";
+  std::uint64_t hash = fnv1a(url);
+  std::string name(16, '0');
+  for (int i = 15; i >= 0; --i)
+  {
+    name[i] = hexDigits[hash & 0x0F];
+    hash >>= 4;
+  }
+  return (std::filesystem::path(m_Directory) / (name + extension)).string();
+}
+
+std::string FetchCache::snapshotFileName(const std::string& url) const
+{
+  return fileName(url, ".snapshot");
+}
+
+bool FetchCache::readValidators(std::istream& stream, const std::string& url, Entry& entry)
+{
+  std::string signature;
+  if (!std::getline(stream, signature) || (signature != cCacheFileSignature))
+    return false;
+  if (!std::getline(stream, entry.url) || !std::getline(stream, entry.etag)
+      || !std::getline(stream, entry.lastModified))
+    return false;
+  //hash collision or outdated entry
+  return entry.url == url;
+}
+
+bool FetchCache::loadValidators(const std::string& url, Entry& entry) const
+{
+  std::ifstream stream(fileName(url), std::ios::in | std::ios::binary);
+  return stream.good() && readValidators(stream, url, entry);
+}
+
+bool FetchCache::load(const std::string& url, Entry& entry) const
+{
+  std::ifstream stream(fileName(url), std::ios::in | std::ios::binary);
+  if (!stream.good() || !readValidators(stream, url, entry))
+    return false;
+  entry.body.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+  return !stream.bad();
+}
+
+bool FetchCache::store(const std::string& url, const std::vector<std::string>& responseHeaders,
+                       const std::string& body) const
+{
+  const std::string etag = headerValue(responseHeaders, "ETag");
+  const std::string lastModified = headerValue(responseHeaders, "Last-Modified");
+  /* The old entry belongs to an older body, so it must not be used for the
+     next conditional request, even if the new body cannot be stored. Line
+     breaks would break the file format, and they are not valid here anyway. */
+  if ((etag.empty() && lastModified.empty()) || (url.find('\n') != std::string::npos)
+      || (etag.find('\n') != std::string::npos)
+      || (lastModified.find('\n') != std::string::npos))
+  {
+    remove(url);
+    return false;
+  }
+
+  //The snapshot belongs to the old body, so it must not be used anymore.
+  std::error_code error;
+  std::filesystem::remove(snapshotFileName(url), error);
+  if (error)
+  {
+    std::cerr << "Error: Could not remove outdated snapshot for " << url << "!" << std::endl;
+    return false;
+  }
+
+  //Readers must never see a half written entry, e.g. after a crash.
+  const std::string head = cCacheFileSignature + '\n' + url + '\n' + etag + '\n'
+                         + lastModified + '\n';
+  AtomicFile file;
+  if (!file.open(fileName(url)) || !file.write(head.data(), head.size())
+      || !file.write(body.data(), body.size()) || !file.commit(AtomicFile::Sync::None))
+  {
+    std::cerr << "Error: Could not write cache file for " << url << "!" << std::endl;
+    remove(url);
+    return false;
+  }
+  return true;
+}
+
+bool FetchCache::remove(const std::string& url) const
+{
+  std::error_code error;
+  std::filesystem::remove(snapshotFileName(url), error);
+  bool success = !error;
+  std::filesystem::remove(fileName(url), error);
+  success = success && !error;
+  if (!success)
+    std::cerr << "Error: Could not remove cache entry for " << url << "!" << std::endl;
+  return success;
+}
+
+std::string FetchCache::mergeRecordFileName(const std::string& output, std::string& key) const
+{
+  std::error_code error;
+  const std::filesystem::path absolute = std::filesystem::absolute(output, error);
+  key = error ? output : absolute.lexically_normal().string();
+  return fileName(key, ".merged");
+}
+
+bool FetchCache::loadMergeRecord(const std::string& output, std::vector<Entry>& versions) const
+{
+  versions.clear();
+  std::string key;
+  std::ifstream stream(mergeRecordFileName(output, key), std::ios::in | std::ios::binary);
+  if (!stream.good())
+    return false;
+  std::string line;
+  if (!std::getline(stream, line) || (line != cMergeRecordSignature))
+    return false;
+  //hash collision or record of another file
+  if (!std::getline(stream, line) || (line != key))
+    return false;
+  Entry entry;
+  while (std::getline(stream, entry.url))
+  {
+    if (!std::getline(stream, entry.etag) || !std::getline(stream, entry.lastModified))
+    {
+      versions.clear();
+      return false;
+    }
+    versions.push_back(entry);
+  } //while
+  return !stream.bad();
+}
+
+bool FetchCache::storeMergeRecord(const std::string& output, const std::vector<Entry>& versions) const
+{
+  std::string key;
+  const std::string recordFile = mergeRecordFileName(output, key);
+  std::string data = cMergeRecordSignature + '\n' + key + '\n';
+  for (const Entry& entry : versions)
+  {
+    if (!entry.url.empty())
+      data += entry.url + '\n' + entry.etag + '\n' + entry.lastModified + '\n';
+  } //for
+  AtomicFile file;
+  if (file.open(recordFile) && file.write(data.data(), data.size())
+      && file.commit(AtomicFile::Sync::None))
+    return true;
+  std::cerr << "Error: Could not write the merge record for " << output << "!" << std::endl;
+  std::error_code error;
+  std::filesystem::remove(recordFile, error);
+  return false;
+}
+
+bool FetchCache::addConditionalHeaders(const std::string& url, Curly& curly) const
+{
+  //The body is not needed for the headers, so it is not read at all.
+  Entry entry;
+  if (!loadValidators(url, entry))
+    return false;
+  bool added = false;
+  if (!entry.etag.empty())
+    added = curly.addHeader("If-None-Match: " + entry.etag);
+  if (!entry.lastModified.empty())
+    added = curly.addHeader("If-Modified-Since: " + entry.lastModified) || added;
+  return added;
+}
+
+std::string FetchCache::headerValue(const std::vector<std::string>& responseHeaders,
+                                    const std::string& name)
+{
+  std::string value;
+  for (const auto& line : responseHeaders)
+  {
+    //status line of a new response, e.g. after a redirect
+    if (line.substr(0, 5) == "HTTP/")
+    {
+      value.clear();
+      continue;
+    }
+    if ((line.size() <= name.size()) || (line[name.size()] != ':'))
+      continue;
+    bool matches = true;
+    for (std::string::size_type i = 0; i < name.size(); ++i)
+    {
+      if (std::tolower(static_cast<unsigned char>(line[i]))
+          != std::tolower(static_cast<unsigned char>(name[i])))
+      {
+        matches = false;
+        break;
+      }
+    } //for
+    if (!matches)
+      continue;
+    std::string::size_type start = name.size() + 1;
+    while ((start < line.size()) && std::isspace(static_cast<unsigned char>(line[start])))
+      ++start;
+    value = line.substr(start);
+  } //for
+  return value;
+}
@@ -0,0 +1,211 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the feed merger.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef FETCHCACHE_HPP
+#define FETCHCACHE_HPP
+
+#include <string>
+#include <vector>
+#include "../Curly.hpp"
+
+/** \brief on-disk cache for feed sources that allows conditional requests
+ *
+ * For every URL the cache stores the body of the last successful transfer
+ * together with the validators (ETag and Last-Modified) the server sent.
+ * Later transfers of the same URL send these validators, so the server can
+ * answer with "304 Not Modified" instead of sending the whole feed again.
+ */
+class FetchCache
+{
+  public:
+    /** \brief cache entry of a single URL
+     */
+    struct Entry
+    {
+      /** default constructor */
+      Entry();
+
+      std::string url;          /**< URL of the feed */
+      std::string etag;         /**< value of the ETag header, may be empty */
+      std::string lastModified; /**< value of the Last-Modified header, may be empty */
+      std::string body;         /**< body of the last successful response */
+    }; //struct
+
+
+    /** \brief constructor
+     *
+     * \param directory  directory where the cache files are stored
+     */
+    explicit FetchCache(const std::string& directory);
+
+
+    /** \brief gets the directory of the cache
+     *
+     * \return Returns the directory where the cache files are stored.
+     */
+    const std::string& directory() const;
+
+
+    /** \brief creates the cache directory, if it does not exist yet
+     *
+     * \return Returns true, if the directory exists or was created.
+     *         Returns false, if the directory could not be created.
+     */
+    bool create() const;
+
+
+    /** \brief loads the cache entry of a URL
+     *
+     * \param url    the URL
+     * \param entry  variable that will be used to store the entry
+     * \return Returns true, if an entry for the URL exists and was loaded.
+     *         Returns false otherwise.
+     */
+    bool load(const std::string& url, Entry& entry) const;
+
+
+    /** \brief loads the validators of a URL's cache entry, but not its body
+     *
+     * \param url    the URL
+     * \param entry  variable that will be used to store the entry; its body
+     *               is left unchanged
+     * \return Returns true, if an entry for the URL exists and its
+     *         validators were loaded. Returns false otherwise.
+     */
+    bool loadValidators(const std::string& url, Entry& entry) const;
+
+
+    /** \brief stores the result of a successful transfer in the cache
+     *
+     * \param url              the URL
+     * \param responseHeaders  response headers of the transfer
+     * \param body             the response body
+     * \return Returns true, if the entry was stored.
+     *         Returns false, if an error occurred or the response has no
+     *         validators, i.e. neither an ETag nor a Last-Modified header.
+     * \remarks The snapshot of the previous body is removed, because it
+     *          does not match the new body anymore. A response that cannot
+     *          be stored removes the previous entry, too.
+     */
+    bool store(const std::string& url, const std::vector<std::string>& responseHeaders,
+               const std::string& body) const;
+
+
+    /** \brief removes the cache entry and the snapshot of a URL
+     *
+     * \param url  the URL
+     * \return Returns true, if nothing of the URL is left in the cache.
+     *         Returns false, if a file could not be removed.
+     */
+    bool remove(const std::string& url) const;
+
+
+    /** \brief loads the record of the feed versions that a merged feed contains
+     *
+     * \param output    file name of the merged feed
+     * \param versions  variable that will be used to store the versions, i.e.
+     *                  URL and validators of each feed; the bodies are empty
+     * \return Returns true, if a record for the merged feed exists and was
+     *         loaded. Returns false otherwise.
+     */
+    bool loadMergeRecord(const std::string& output, std::vector<Entry>& versions) const;
+
+
+    /** \brief stores which feed versions a merged feed contains
+     *
+     * \param output    file name of the merged feed
+     * \param versions  URL and validators of each feed in the merged feed;
+     *                  entries with an empty URL are skipped
+     * \return Returns true, if the record was stored.
+     *         Returns false, if an error occurred. The previous record is
+     *         removed in that case, because it does not match anymore.
+     * \remarks The record allows to skip unchanged feeds in the next
+     *          incremental merge, but only if the version that the server
+     *          confirms with "304 Not Modified" is in the merged feed.
+     */
+    bool storeMergeRecord(const std::string& output, const std::vector<Entry>& versions) const;
+
+
+    /** \brief gets the path of the snapshot file for a URL
+     *
+     * \param url  the URL
+     * \return Returns the path of the file that holds the parsed feed of the
+     *         cached body, see RSS20::Snapshot. The file may not exist.
+     */
+    std::string snapshotFileName(const std::string& url) const;
+
+
+    /** \brief adds the headers for a conditional request to a transfer
+     *
+     * \param url    the URL
+     * \param curly  the Curly instance that will perform the transfer
+     * \return Returns true, if an entry for the URL exists and the headers
+     *         If-None-Match and/or If-Modified-Since were added.
+     *         Returns false otherwise.
+     */
+    bool addConditionalHeaders(const std::string& url, Curly& curly) const;
+
+
+    /** \brief gets the value of a header from a list of response headers
+     *
+     * \param responseHeaders  response headers of a transfer
+     * \param name             the header's name (case-insensitive)
+     * \return Returns the value of the last header with that name after the
+     *         last status line, i.e. the one of the final response in case
+     *         of redirects. Returns an empty string, if there is no such
+     *         header.
+     */
+    static std::string headerValue(const std::vector<std::string>& responseHeaders,
+                                   const std::string& name);
+  private:
+    /** \brief gets the path of the cache file for a URL
+     *
+     * \param url        the URL
+     * \param extension  extension of the file, including the dot
+     * \return Returns the path of the cache file.
+     */
+    std::string fileName(const std::string& url, const std::string& extension = ".cache") const;
+
+
+    /** \brief gets the path of the merge record for a merged feed
+     *
+     * \param output  file name of the merged feed
+     * \param key     variable that will receive the absolute path of the
+     *                merged feed, which identifies the record
+     * \return Returns the path of the record file.
+     */
+    std::string mergeRecordFileName(const std::string& output, std::string& key) const;
+
+
+    /** \brief reads the signature and the validators from a cache file
+     *
+     * \param stream  stream of the cache file, positioned at its start
+     * \param url     the URL
+     * \param entry   variable that will be used to store the validators
+     * \return Returns true, if the file is a valid entry for the URL.
+     *         Returns false otherwise. On success, the stream is positioned
+     *         at the start of the body.
+     */
+    static bool readValidators(std::istream& stream, const std::string& url, Entry& entry);
+
+    std::string m_Directory; /**< directory of the cache files */
+}; //class FetchCache
+
+#endif // FETCHCACHE_HPP
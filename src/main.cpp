@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the feed merger.
-    Copyright (C) 2015, 2017  Dirk Stolle
+    Copyright (C) 2015, 2017, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -19,16 +19,36 @@
 */
 
 #include <algorithm>
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <filesystem>
 #include <iostream>
+#include <memory>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
-#include "Curly.hpp"
+#include "AtomicFile.hpp"
+#include "CurlyMulti.hpp"
+#include "FeedServer.hpp"
+#include "JobFile.hpp"
+#include "MappedFile.hpp"
+#include "Parallel.hpp"
+#include "RefreshScheduler.hpp"
+#include "cache/FetchCache.hpp"
+#include "rfc822/Date.hpp"
 #include "rss2.0/Channel.hpp"
+#include "rss2.0/Deduplicator.hpp"
 #include "rss2.0/Merger.hpp"
 #include "rss2.0/Parser.hpp"
+#include "rss2.0/Snapshot.hpp"
 #include "rss2.0/Writer.hpp"
 #include "StringFunctions.hpp"
+#include "xml/XMLDocument.hpp"
+#include "xml/XMLPushParser.hpp"
 
 //Return code that indicates invalid command line arguments.
 const int rcInvalidParameter = 1;
@@ -44,6 +64,15 @@ const int rcMergeError = 5;
 //The default output file name that is used if no file name is given.
 const std::string cDefaultOutputFileName = "merged-feeds.xml";
 
+//The output file name that writes the merged feed to the standard output.
+const std::string cStandardOutputName = "-";
+
+//The default number of feeds that are fetched at the same time.
+const unsigned int cDefaultMaxTransfers = 8;
+
+//The default number of seconds between two refreshes of a feed in daemon mode.
+const unsigned int cDefaultInterval = 900;
+
 //strings that indicate the program's version
 const std::string cVersionString( "feed-merger, version 0.08, 2022-04-11");
 const std::string cVersionStringGenerator("feed-merger v0.08");
@@ -55,23 +84,791 @@ void showVersion()
 
 void showHelp()
 {
-  std::cout << "\nfeed-merger [URL ...] [-o FILE]" << std::endl
+  std::cout << "\nfeed-merger [URL ...] [PATH ...] [-o FILE]" << std::endl
             << "options:" << std::endl
             << "  URL           - URL of an RSS 2.0 feed that shall be merged. Can be repeated" << std::endl
             << "                  multiple times to specify several feeds." << std::endl
+            << "  PATH          - path of a local RSS 2.0 feed file that shall be merged. If" << std::endl
+            << "                  PATH is a directory, all files in that directory are used." << std::endl
+            << "                  Can be repeated multiple times, too." << std::endl
             << "  --output FILE - specify the file name for the merged feed. Defaults to" << std::endl
             << "                  " << cDefaultOutputFileName << ", if not specified." << std::endl
+            << "                  Use - as FILE to write the merged feed to the standard" << std::endl
+            << "                  output instead, e.g. to pipe it into another program." << std::endl
             << "  -o FILE       - same as --output" << std::endl
+            << "  --cache DIR   - keep the fetched feeds in the directory DIR and only" << std::endl
+            << "                  download feeds again when they have changed." << std::endl
+            << "  --max-transfers N - fetch at most N feeds at the same time. Defaults to" << std::endl
+            << "                  " << cDefaultMaxTransfers << ", if not specified." << std::endl
+            << "  --threads N   - parse the feeds with up to N threads. Defaults to the" << std::endl
+            << "                  number of processor cores, if not specified." << std::endl
+            << "  --max-items N - only put the N newest items into the merged feed." << std::endl
+            << "  --since DATE  - only put items published at or after DATE into the merged" << std::endl
+            << "                  feed. DATE uses the RFC 822 format of RSS feeds, e.g." << std::endl
+            << "                  \"Sun, 01 Mar 2026 00:00:00 GMT\"." << std::endl
+            << "  --dedup KEYS  - only keep one copy of items that occur more than" << std::endl
+            << "                  once. KEYS is a comma-separated list of the item data that" << std::endl
+            << "                  identifies an item: guid, link, title (title and date)." << std::endl
+            << "                  An item is a duplicate, if any of these keys matches." << std::endl
+            << "                  Example: --dedup guid,link,title" << std::endl
+            << "  --dedup-prefer COPY - which copy of a duplicate item is kept: newest" << std::endl
+            << "                  (default) or first (the copy of the first feed, in the" << std::endl
+            << "                  order the feeds were given). Implies --dedup" << std::endl
+            << "                  guid,link,title, if --dedup is not given." << std::endl
+            << "  --incremental - add the new items to the previously merged feed in the" << std::endl
+            << "                  output file instead of merging from scratch. Together with" << std::endl
+            << "                  --cache, feeds that have not changed are not parsed at all." << std::endl
+            << "                  Implies --dedup guid,link,title, if --dedup is not given." << std::endl
+            << "  --sync POLICY - how the output file is flushed to the disk before it" << std::endl
+            << "                  replaces the previous output file: none, file (default)" << std::endl
+            << "                  or full (file and directory)." << std::endl
+            << "  --gzip        - write a gzip-compressed copy of the output file with the" << std::endl
+            << "                  additional extension .gz, too." << std::endl
+            << "  --daemon      - keep running, refresh each feed when it is due and" << std::endl
+            << "                  rewrite the output file only when the merged feed has" << std::endl
+            << "                  changed. Feeds are refreshed after the interval given by" << std::endl
+            << "                  --interval or after their ttl, if that is longer, and not" << std::endl
+            << "                  within their skipHours and skipDays. Stop it with SIGINT" << std::endl
+            << "                  or SIGTERM." << std::endl
+            << "  --serve [ADDRESS:]PORT - serve the merged feed via HTTP on the given port" << std::endl
+            << "                  and IPv4 address (default: 127.0.0.1). Implies --daemon." << std::endl
+            << "                  The output file is only written, if --output is given." << std::endl
+            << "  --interval N  - refresh feeds in daemon mode every N seconds. Defaults to" << std::endl
+            << "                  " << cDefaultInterval << ", if not specified." << std::endl
+            << "  --jobs FILE   - merges several feeds at once as described in the job file" << std::endl
+            << "                  FILE. Every feed is fetched and parsed only once, even if" << std::endl
+            << "                  several merged feeds use it. FILE has a section for each" << std::endl
+            << "                  merged feed that starts with its name in square brackets" << std::endl
+            << "                  followed by lines \"key = value\" with the keys output," << std::endl
+            << "                  source (once per feed), max-items, since, dedup and" << std::endl
+            << "                  dedup-prefer." << std::endl
             << "  --help        - displays this help message and quits" << std::endl
             << "  -?            - same as --help" << std::endl
             << "  --version     - displays the version of the program and quits" << std::endl
             << "  -v            - same as --version" << std::endl;
 }
 
+/* Source and result of parsing a single feed. */
+struct ParseJob
+{
+  enum class Kind { Transfer, Snapshot, Cached, File, Unchanged };
+
+  Kind kind = Kind::Transfer;
+  std::string location;   //URL or file name of the feed
+  XMLPushParser * pushParser = nullptr; //parser that got the transferred data
+  std::string cachedSource; //source of an unmodified feed from the cache
+  const FetchCache * cache = nullptr; //cache with the snapshot of an unmodified feed
+  FetchCache::Entry version; //URL and validators of the loaded version, URL is empty if unknown
+  int returnCode = 0;     //zero on success, return code of the error otherwise
+  std::string error;      //error message
+};
+
+/* Parses the feed of a job. This may run on any thread, so errors are stored
+   in the job instead of being printed right away. */
+void parseFeed(ParseJob& job, RSS20::Channel& feed)
+{
+  //Jobs of feeds that could not be fetched have nothing to parse.
+  if (job.returnCode != 0)
+    return;
+  switch (job.kind)
+  {
+    case ParseJob::Kind::Transfer:
+         {
+           if (!job.pushParser->finish())
+           {
+             job.returnCode = rcParserError;
+             job.error = "Error: Could not parse the data from feed "
+                       + job.location + " as XML!";
+             return;
+           }
+           const XMLDocument doc(job.pushParser->takeDocument());
+           if (!RSS20::Parser::fromDocument(doc, feed))
+           {
+             job.returnCode = rcParserError;
+             job.error = "Error: Could not parse the data from feed "
+                       + job.location + " as RSS 2.0!";
+           }
+         }
+         break;
+    case ParseJob::Kind::Snapshot:
+         //Loading the parsed feed is much faster than parsing its XML again.
+         if (RSS20::Snapshot::fromFile(job.cache->snapshotFileName(job.location), feed))
+           break;
+         //The snapshot is broken, so parse the cached source instead.
+         {
+           FetchCache::Entry entry;
+           if (!job.cache->load(job.location, entry))
+           {
+             job.returnCode = rcNetworkError;
+             job.error = "Error: Feed from " + job.location + " has not changed, "
+                       + "but it is not in the cache!";
+             return;
+           }
+           job.kind = ParseJob::Kind::Cached;
+           job.cachedSource = std::move(entry.body);
+         }
+         [[fallthrough]];
+    case ParseJob::Kind::Cached:
+         if (!RSS20::Parser::fromBuffer(job.cachedSource.data(), job.cachedSource.size(),
+                                        feed, nullptr, XMLDocument::NoBlanksParseOptions))
+         {
+           job.returnCode = rcParserError;
+           job.error = "Error: Could not parse the cached data of feed "
+                     + job.location + " as RSS 2.0!";
+         }
+         std::string().swap(job.cachedSource);
+         break;
+    case ParseJob::Kind::File:
+         {
+           /* Local feed files are mapped into memory and parsed in place, so
+              there is no need to read them into a buffer first. */
+           MappedFile mappedFile;
+           if (!mappedFile.open(job.location))
+           {
+             job.returnCode = rcFileError;
+             job.error = "Error: Could not read the feed file " + job.location + "!";
+             return;
+           }
+           if (!RSS20::Parser::fromBuffer(mappedFile.data(), mappedFile.size(), feed,
+                                          nullptr, XMLDocument::NoBlanksParseOptions))
+           {
+             job.returnCode = rcParserError;
+             job.error = "Error: Could not parse the feed file " + job.location
+                       + " as RSS 2.0!";
+           }
+         }
+         break;
+    case ParseJob::Kind::Unchanged:
+         //Items are already part of the previous merged feed.
+         break;
+  } //switch
+}
+
+/* Checks whether a source of a feed is a URL instead of a local path. */
+bool isFeedURL(const std::string& source)
+{
+  return (source.substr(0, 7) == "http://")
+      or (source.substr(0, 8) == "https://")
+      or (source.substr(0, 6) == "ftp://");
+}
+
+/* Adds a local feed file or all files of a directory to the list of local
+   feeds. Returns false, if the path is not usable or if a file was already
+   added before. */
+bool addLocalFeeds(const std::string& path, std::vector<std::string>& feedFiles,
+                   std::unordered_set<std::string>& knownFiles)
+{
+  std::error_code error;
+  std::vector<std::string> files;
+  if (std::filesystem::is_directory(path, error))
+  {
+    for (const auto& entry : std::filesystem::directory_iterator(path, error))
+    {
+      if (entry.is_regular_file(error))
+        files.push_back(entry.path().lexically_normal().string());
+    } //for
+    if (error)
+    {
+      std::cerr << "Error: Could not read directory " << path << ": "
+                << error.message() << std::endl;
+      return false;
+    }
+    //Directory iteration order is unspecified, but results should not be.
+    std::sort(files.begin(), files.end());
+  }
+  else if (std::filesystem::is_regular_file(path, error))
+  {
+    files.push_back(std::filesystem::path(path).lexically_normal().string());
+  }
+  else
+  {
+    std::cerr << "Error: " << path << " is neither a feed URL nor an existing "
+              << "file or directory." << std::endl;
+    return false;
+  }
+
+  for (const auto& file : files)
+  {
+    if (!knownFiles.insert(file).second)
+    {
+      std::cerr << "Error: feed file " << file << " was given more than once!"
+                << std::endl;
+      return false;
+    }
+    feedFiles.push_back(file);
+  } //for
+  return true;
+}
+
+/* Settings for loading feeds that are the same for every run. */
+struct LoadSettings
+{
+  unsigned int maxTransfers = cDefaultMaxTransfers; //feeds fetched at the same time
+  unsigned int parseThreads = 1; //threads that parse the feeds
+  FetchCache * cache = nullptr; //cache for conditional requests, may be nullptr
+};
+
+/* Checks whether two feed versions are known and have the same validators. */
+bool sameVersion(const FetchCache::Entry& known, const FetchCache::Entry& other)
+{
+  return !known.url.empty() && (known.url == other.url) && (known.etag == other.etag)
+      && (known.lastModified == other.lastModified);
+}
+
+/* Fetches the feeds from the URLs and parses them together with the local
+   feed files. jobs and feeds get one element per URL, followed by one per
+   file. Feeds that did not change since the last transfer (HTTP 304) become
+   Unchanged jobs, if knownVersions says that the cached version's items are
+   known already, and they are loaded from the cache otherwise. With a cache,
+   each job gets the version of the feed that it loaded. Errors of single
+   feeds are stored in their jobs. Returns false, if the transfers could not
+   be run at all. */
+bool loadFeeds(const std::vector<std::string>& feedURLs,
+               const std::vector<FetchCache::Entry>& knownVersions,
+               const std::vector<std::string>& feedFiles, const LoadSettings& settings,
+               CurlyHandlePool& handlePool, std::vector<ParseJob>& jobs,
+               std::vector<RSS20::Channel>& feeds)
+{
+  FetchCache * cache = settings.cache;
+  CurlyMulti fetcher;
+  fetcher.setMaximumTransfers(settings.maxTransfers);
+  fetcher.setHandlePool(&handlePool);
+  //The data of each feed is parsed while it arrives, so the raw data does not
+  //need to be kept in memory - unless the cache needs it.
+  std::vector<std::unique_ptr<XMLPushParser> > parsers;
+  std::vector<std::string> rawSources(feedURLs.size());
+  for (std::size_t idx = 0; idx < feedURLs.size(); ++idx)
+  {
+    Curly& cURL = fetcher.add(feedURLs[idx]);
+    //Allow cURL to follow redirects, ...
+    cURL.followRedirects(true);
+    /* ... but only up to three. That should be more than enough for most
+       sanely configured servers and avoids endless redirect loops. */
+    cURL.setMaximumRedirects(3);
+    //Feeds compress well, so let the server compress them.
+    cURL.enableCompression(true);
+    //Only get the feed, if it has changed since the last time.
+    if (cache != nullptr)
+      cache->addConditionalHeaders(feedURLs[idx], cURL);
+    //Whitespace between the elements is irrelevant for the parser.
+    parsers.push_back(std::make_unique<XMLPushParser>(XMLDocument::NoBlanksParseOptions));
+    XMLPushParser * parser = parsers.back().get();
+    std::string * raw = (cache != nullptr) ? &rawSources[idx] : nullptr;
+    cURL.setWriteSink([parser, raw](const char* data, const std::size_t size)
+    {
+      if (raw != nullptr)
+        raw->append(data, size);
+      /* Parser errors are checked after the transfer, because the response
+         code gives a better error message for things like HTML error pages. */
+      parser->push(data, size);
+      return true;
+    });
+  } //for
+  std::vector<CurlyMulti::Result> results;
+  if (!fetcher.performAll(results))
+    return false;
+
+  //Parse feed sources into RSS 2.0 feeds.
+  /* TODO: Support Atom feeds, too! */
+
+  jobs = std::vector<ParseJob>(feedURLs.size() + feedFiles.size());
+  std::uint64_t downloadedBytes = 0;
+  std::uint64_t decodedBytes = 0;
+  for (std::size_t idx = 0; idx < results.size(); ++idx)
+  {
+    const auto & result = results[idx];
+    const Curly & transfer = fetcher.transfer(idx);
+    ParseJob& job = jobs[idx];
+    downloadedBytes += transfer.getDownloadedBytes();
+    decodedBytes += transfer.getDecodedBytes();
+    job.location = result.url;
+    if (!result.success)
+    {
+      job.returnCode = rcNetworkError;
+      job.error = "Error: Unable to retrieve feed from " + result.url + "!";
+      if (!result.error.empty())
+        job.error += " " + result.error;
+      continue;
+    } //if
+    //"304 Not Modified": use the data from the cache
+    if ((cache != nullptr) && (result.responseCode == 304))
+    {
+      FetchCache::Entry entry;
+      if (!cache->loadValidators(result.url, entry))
+      {
+        job.returnCode = rcNetworkError;
+        job.error = "Error: Feed from " + result.url + " has not changed, "
+                  + "but it is not in the cache!";
+        continue;
+      }
+      job.version = entry;
+      /* No need to load anything, if the items of exactly this version are
+         known already. Another version may be known, e.g. when a previous
+         run failed after the cache was updated. */
+      if (sameVersion(knownVersions.at(idx), entry))
+      {
+        job.kind = ParseJob::Kind::Unchanged;
+        continue;
+      }
+      //The snapshot of the parsed feed is loaded while parsing.
+      std::error_code error;
+      if (std::filesystem::is_regular_file(cache->snapshotFileName(result.url), error))
+      {
+        job.kind = ParseJob::Kind::Snapshot;
+        job.cache = cache;
+        continue;
+      }
+      if (!cache->load(result.url, entry))
+      {
+        job.returnCode = rcNetworkError;
+        job.error = "Error: Feed from " + result.url + " has not changed, "
+                  + "but it is not in the cache!";
+        continue;
+      }
+      job.kind = ParseJob::Kind::Cached;
+      job.cachedSource = std::move(entry.body);
+      continue;
+    } //if not modified
+    if (result.responseCode != 200)
+    {
+      job.returnCode = rcNetworkError;
+      job.error = "Error: Retrieving feed from " + result.url + " returned "
+                + "unexpected response code " + std::to_string(result.responseCode)
+                + ". Expected: 200.";
+      continue;
+    }
+    if (transfer.getDecodedBytes() == 0)
+    {
+      job.returnCode = rcNetworkError;
+      job.error = "Error: Getting URL " + result.url + " returned empty result!";
+      continue;
+    }
+    job.kind = ParseJob::Kind::Transfer;
+    job.pushParser = parsers[idx].get();
+  } //for
+  if (decodedBytes > 0)
+  {
+    std::cerr << "Info: Received " << downloadedBytes << " bytes for "
+              << decodedBytes << " bytes of feed data";
+    if (downloadedBytes < decodedBytes)
+      std::cerr << " (" << (100 * (decodedBytes - downloadedBytes) / decodedBytes)
+                << " % saved by compression)";
+    std::cerr << "." << std::endl;
+  }
+  for (std::size_t idx = 0; idx < feedFiles.size(); ++idx)
+  {
+    ParseJob& job = jobs[feedURLs.size() + idx];
+    job.kind = ParseJob::Kind::File;
+    job.location = feedFiles[idx];
+  } //for
+
+  //Feeds are independent of each other, so they are parsed in parallel.
+  feeds = std::vector<RSS20::Channel>(jobs.size());
+  #ifdef DEBUG
+  std::cerr << "Parsing " << jobs.size() << " feeds ..." << std::endl;
+  #endif // DEBUG
+  parallelFor(jobs.size(), settings.parseThreads, [&jobs, &feeds](const std::size_t idx)
+  {
+    parseFeed(jobs[idx], feeds[idx]);
+  });
+  parsers.clear();
+  if (cache != nullptr)
+  {
+    for (std::size_t idx = 0; idx < results.size(); ++idx)
+    {
+      ParseJob& job = jobs[idx];
+      if (job.returnCode != 0)
+        continue;
+      bool cached = (job.kind == ParseJob::Kind::Cached);
+      if (job.kind == ParseJob::Kind::Transfer)
+      {
+        const auto& headers = fetcher.transfer(idx).responseHeaders();
+        cached = cache->store(results[idx].url, headers, rawSources[idx]);
+        std::string().swap(rawSources[idx]);
+        //Without a cache entry, the version cannot be confirmed by a 304 later.
+        if (cached)
+        {
+          job.version.url = results[idx].url;
+          job.version.etag = FetchCache::headerValue(headers, "ETag");
+          job.version.lastModified = FetchCache::headerValue(headers, "Last-Modified");
+        }
+      }
+      //Next time the feed has not changed, it is loaded from the snapshot.
+      if (cached && !RSS20::Snapshot::toFile(feeds[idx], cache->snapshotFileName(results[idx].url)))
+      {
+        std::cerr << "Warning: Could not store the snapshot of feed "
+                  << results[idx].url << " in the cache." << std::endl;
+      }
+    } //for
+  } //if cache
+  return true;
+}
+
+/* Settings for merging the feeds. */
+struct MergeSettings
+{
+  std::size_t maxItems = 0; //maximum number of items, zero means no limit
+  std::time_t since = RSS20::Channel::NoDate; //oldest publication date
+  std::vector<RSS20::Deduplicator::Key> dedupKeys; //keys for duplicates
+  RSS20::Deduplicator::Prefer dedupPrefer = RSS20::Deduplicator::Prefer::Newest; //copy that is kept
+};
+
+/* Merges the feeds into one feed. feedCount is the number of feeds that is
+   shown in the title and description of the merged feed. Returns false, if
+   the feeds could not be merged. */
+bool mergeFeeds(std::vector<RSS20::Channel>&& feeds, const std::size_t feedCount,
+                const MergeSettings& settings, RSS20::Channel& mergedFeed)
+{
+  /* The items of the merged feed are sorted by date, newest item first.
+     Items beyond the limits are dropped per feed, before they are sorted. */
+  std::unique_ptr<RSS20::Deduplicator> deduplicator;
+  if (!settings.dedupKeys.empty())
+    deduplicator = std::make_unique<RSS20::Deduplicator>(settings.dedupKeys, settings.dedupPrefer);
+  if (!RSS20::Merger::mergeSorted(std::move(feeds), mergedFeed, settings.maxItems,
+                                  settings.since, deduplicator.get()))
+  {
+    std::cerr << "Something wet wrong while merging the feeds!" << std::endl;
+    return false;
+  }
+  //Title and description have to count the feeds, not e.g. a previous result.
+  RSS20::Merger::describeMerge(mergedFeed, feedCount);
+  if (deduplicator && (deduplicator->duplicates() > 0))
+  {
+    std::cerr << "Info: Removed " << deduplicator->duplicates()
+              << " duplicate item(s)." << std::endl;
+  }
+  //Set name of generator.
+  mergedFeed.setGenerator(cVersionStringGenerator);
+  return true;
+}
+
+/* Runs all jobs of a job file. Every feed is loaded only once, no matter
+   how many jobs use it, and then merged into all of these jobs. A job whose
+   feeds could not be loaded is skipped, but the other jobs still run.
+   Returns zero, if all jobs succeeded, or the return code of the first
+   error otherwise. */
+int runJobs(const std::vector<JobFile::Job>& mergeJobs, const LoadSettings& settings,
+            const AtomicFile::Sync sync, const bool gzipCopy)
+{
+  std::vector<std::string> feedURLs;
+  std::vector<std::string> feedFiles;
+  std::unordered_map<std::string, std::size_t> urlIndices;
+  std::unordered_map<std::string, std::size_t> fileIndices;
+  //Sources of each job: whether it is a URL, and its index in URLs or files.
+  std::vector<std::vector<std::pair<bool, std::size_t> > > jobSources(mergeJobs.size());
+  for (std::size_t idx = 0; idx < mergeJobs.size(); ++idx)
+  {
+    std::unordered_set<std::string> knownURLs;
+    std::unordered_set<std::string> knownFiles;
+    for (const auto& source : mergeJobs[idx].sources)
+    {
+      if (isFeedURL(source))
+      {
+        if (!knownURLs.insert(source).second)
+        {
+          std::cerr << "Error: feed URL " << source << " was given more than "
+                    << "once in job " << mergeJobs[idx].name << "!" << std::endl;
+          return rcInvalidParameter;
+        }
+        const auto inserted = urlIndices.emplace(source, feedURLs.size());
+        if (inserted.second)
+          feedURLs.push_back(source);
+        jobSources[idx].emplace_back(true, inserted.first->second);
+        continue;
+      }
+      std::vector<std::string> files;
+      if (!addLocalFeeds(source, files, knownFiles))
+        return rcInvalidParameter;
+      for (const auto& file : files)
+      {
+        const auto inserted = fileIndices.emplace(file, feedFiles.size());
+        if (inserted.second)
+          feedFiles.push_back(file);
+        jobSources[idx].emplace_back(false, inserted.first->second);
+      } //for
+    } //for
+  } //for
+
+  CurlyHandlePool handlePool;
+  std::vector<ParseJob> jobs;
+  std::vector<RSS20::Channel> feeds;
+  if (!loadFeeds(feedURLs, std::vector<FetchCache::Entry>(feedURLs.size()), feedFiles,
+                 settings, handlePool, jobs, feeds))
+  {
+    std::cerr << "Error: Unable to retrieve the feeds!" << std::endl;
+    return rcNetworkError;
+  }
+  std::cerr << "Info: Loaded " << feeds.size() << " distinct feed(s) for "
+            << mergeJobs.size() << " job(s)." << std::endl;
+  //Report errors in input order, but only once per feed.
+  for (const auto& job : jobs)
+  {
+    if (job.returnCode != 0)
+      std::cerr << job.error << std::endl;
+  } //for
+
+  //The last job that uses a feed can take it, all others get a copy.
+  std::vector<std::size_t> uses(feeds.size(), 0);
+  for (auto& sources : jobSources)
+  {
+    for (auto& source : sources)
+    {
+      if (!source.first)
+        source.second += feedURLs.size();
+      ++uses[source.second];
+    } //for
+  } //for
+
+  int returnCode = 0;
+  for (std::size_t idx = 0; idx < mergeJobs.size(); ++idx)
+  {
+    const JobFile::Job& mergeJob = mergeJobs[idx];
+    int jobCode = 0;
+    std::vector<RSS20::Channel> jobFeeds;
+    for (const auto& source : jobSources[idx])
+    {
+      const std::size_t feedIndex = source.second;
+      --uses[feedIndex];
+      if ((jobCode == 0) && (jobs[feedIndex].returnCode != 0))
+        jobCode = jobs[feedIndex].returnCode;
+      if (jobCode != 0)
+        continue;
+      if (uses[feedIndex] == 0)
+        jobFeeds.push_back(std::move(feeds[feedIndex]));
+      else
+        jobFeeds.push_back(feeds[feedIndex]);
+    } //for
+    if (jobCode != 0)
+    {
+      std::cerr << "Error: Job " << mergeJob.name << " was skipped, because "
+                << "not all of its feeds could be loaded." << std::endl;
+    }
+    else
+    {
+      MergeSettings mergeSettings;
+      mergeSettings.maxItems = mergeJob.maxItems;
+      mergeSettings.since = mergeJob.since;
+      mergeSettings.dedupKeys = mergeJob.dedupKeys;
+      mergeSettings.dedupPrefer = mergeJob.dedupPrefer;
+      RSS20::Channel mergedFeed;
+      if (!mergeFeeds(std::move(jobFeeds), jobSources[idx].size(), mergeSettings, mergedFeed))
+        jobCode = rcMergeError;
+      else if (!RSS20::Writer::toFile(mergedFeed, mergeJob.output, sync, gzipCopy))
+      {
+        std::cerr << "Error: Could not write feed of job " << mergeJob.name
+                  << " to " << mergeJob.output << "!" << std::endl;
+        jobCode = rcFileError;
+      }
+      else
+      {
+        std::cerr << "Info: Wrote merged feed of job " << mergeJob.name << " with "
+                  << mergedFeed.items().size() << " item(s) to "
+                  << mergeJob.output << "." << std::endl;
+      }
+    }
+    if (returnCode == 0)
+      returnCode = jobCode;
+  } //for
+  return returnCode;
+}
+
+//set by the signal handler when the daemon shall stop
+volatile std::sig_atomic_t stopRequested = 0;
+
+extern "C" void requestStop(int)
+{
+  stopRequested = 1;
+}
+
+/* Keeps the feeds in memory and refreshes each of them when it is due. The
+   merged feed is only written to the output file (if outputFileName is not
+   empty) and handed to the server (if server is not nullptr), when its
+   content has changed. Runs until SIGINT or SIGTERM is received. */
+int runDaemon(const std::vector<std::string>& feedURLs, const std::vector<std::string>& feedFiles,
+              const LoadSettings& settings, const MergeSettings& mergeSettings,
+              const unsigned int interval, const std::string& outputFileName,
+              const AtomicFile::Sync sync, const bool gzipCopy, FeedServer* server)
+{
+  std::signal(SIGINT, requestStop);
+  std::signal(SIGTERM, requestStop);
+
+  const std::size_t feedCount = feedURLs.size() + feedFiles.size();
+  RefreshScheduler scheduler(feedCount, interval);
+  //latest version of each feed, URLs first, then files
+  std::vector<RSS20::Channel> current(feedCount);
+  std::vector<bool> loaded(feedCount, false);
+  //version of each feed from a URL in current, if it is known
+  std::vector<FetchCache::Entry> versions(feedURLs.size());
+  std::vector<std::filesystem::file_time_type> modified(feedFiles.size());
+  //The pool keeps the connections between refreshes, so they can be reused.
+  CurlyHandlePool handlePool;
+
+  //The output of an earlier run avoids rewriting an unchanged feed on start.
+  RSS20::Channel published;
+  std::error_code error;
+  bool hasPublished = !outputFileName.empty()
+                      && std::filesystem::is_regular_file(outputFileName, error)
+                      && RSS20::Parser::fromFile(outputFileName, published);
+  //The server can serve that until the first merge is done.
+  std::string serialised;
+  if (hasPublished && (server != nullptr)
+      && !(RSS20::Writer::toString(published, serialised) && server->publish(serialised)))
+  {
+    hasPublished = false;
+  }
+
+  std::cerr << "Info: Running as daemon. Feeds are refreshed every " << interval
+            << " seconds or after their ttl. Send SIGINT or SIGTERM to stop."
+            << std::endl;
+  while (stopRequested == 0)
+  {
+    const std::time_t now = std::time(nullptr);
+    std::vector<std::string> dueURLs;
+    std::vector<FetchCache::Entry> knownVersions;
+    std::vector<std::string> dueFiles;
+    //indices of the feeds in the order of the jobs
+    std::vector<std::size_t> sources;
+    const std::vector<std::size_t> due = scheduler.due(now);
+    for (const std::size_t idx : due)
+    {
+      if (idx >= feedURLs.size())
+        continue;
+      dueURLs.push_back(feedURLs[idx]);
+      knownVersions.push_back(loaded[idx] ? versions[idx] : FetchCache::Entry());
+      sources.push_back(idx);
+    } //for
+    for (const std::size_t idx : due)
+    {
+      if (idx < feedURLs.size())
+        continue;
+      //Local files only have to be parsed again, when they were modified.
+      const std::size_t fileIdx = idx - feedURLs.size();
+      const auto time = std::filesystem::last_write_time(feedFiles[fileIdx], error);
+      if (!error && loaded[idx] && (time == modified[fileIdx]))
+      {
+        scheduler.refreshed(idx, current[idx], now);
+        continue;
+      }
+      dueFiles.push_back(feedFiles[fileIdx]);
+      sources.push_back(idx);
+    } //for
+
+    bool changed = false;
+    std::vector<ParseJob> jobs;
+    std::vector<RSS20::Channel> feeds;
+    if (!sources.empty()
+        && !loadFeeds(dueURLs, knownVersions, dueFiles, settings, handlePool, jobs, feeds))
+    {
+      std::cerr << "Error: Unable to retrieve the feeds!" << std::endl;
+      for (const std::size_t idx : sources)
+        scheduler.failed(idx, now);
+    }
+    for (std::size_t job = 0; job < jobs.size(); ++job)
+    {
+      const std::size_t idx = sources[job];
+      //Failed feeds keep their previous content and are retried later.
+      if (jobs[job].returnCode != 0)
+      {
+        std::cerr << jobs[job].error << std::endl;
+        scheduler.failed(idx, now);
+        continue;
+      }
+      if (idx < feedURLs.size())
+        versions[idx] = jobs[job].version;
+      if (jobs[job].kind != ParseJob::Kind::Unchanged)
+      {
+        if (idx >= feedURLs.size())
+        {
+          const std::size_t fileIdx = idx - feedURLs.size();
+          modified[fileIdx] = std::filesystem::last_write_time(feedFiles[fileIdx], error);
+        }
+        current[idx] = std::move(feeds[job]);
+        loaded[idx] = true;
+        changed = true;
+      }
+      scheduler.refreshed(idx, current[idx], now);
+    } //for
+
+    if (changed)
+    {
+      std::vector<RSS20::Channel> available;
+      for (std::size_t idx = 0; idx < feedCount; ++idx)
+      {
+        if (loaded[idx])
+          available.push_back(current[idx]);
+      } //for
+      RSS20::Channel mergedFeed;
+      if (!mergeFeeds(std::move(available), feedCount, mergeSettings, mergedFeed))
+        return rcMergeError;
+      if (hasPublished && (mergedFeed == published))
+      {
+        std::cerr << "Info: The merged feed did not change." << std::endl;
+      }
+      else
+      {
+        //Maybe problems are only temporary, so keep running in any case.
+        bool updated = true;
+        if ((server != nullptr)
+            && !(RSS20::Writer::toString(mergedFeed, serialised) && server->publish(serialised)))
+        {
+          std::cerr << "Error: Could not update the feed of the server!" << std::endl;
+          updated = false;
+        }
+        if (!outputFileName.empty()
+            && !RSS20::Writer::toFile(mergedFeed, outputFileName, sync, gzipCopy))
+        {
+          std::cerr << "Error: Could not write feed to " << outputFileName << "!" << std::endl;
+          updated = false;
+        }
+        if (updated)
+        {
+          std::cerr << "Info: Updated the merged feed, it has "
+                    << mergedFeed.items().size() << " item(s) now." << std::endl;
+          published = std::move(mergedFeed);
+          hasPublished = true;
+        }
+      }
+    } //if changed
+
+    //Wait for the next refresh, but react to signals in time.
+    while ((stopRequested == 0) && (std::time(nullptr) < scheduler.nextRefresh()))
+    {
+      std::this_thread::sleep_for(std::chrono::seconds(1));
+    }
+  } //while
+  std::cerr << "Info: Daemon was stopped." << std::endl;
+  return 0;
+}
+
 int main(int argc, char** argv)
 {
-  std::unordered_set<std::string> feedURLs;
+  //feed URLs in the order they were given on the command line
+  std::vector<std::string> feedURLs;
+  //set of feed URLs for faster detection of duplicates
+  std::unordered_set<std::string> knownURLs;
+  //local feed files, mapped into memory when they are parsed
+  std::vector<std::string> feedFiles;
+  std::unordered_set<std::string> knownFiles;
+  std::error_code fsError;
   std::string outputFileName;
+  unsigned int maxTransfers = 0;
+  unsigned int parseThreads = 0;
+  std::size_t maxItems = 0;
+  std::time_t since = RSS20::Channel::NoDate;
+  std::vector<RSS20::Deduplicator::Key> dedupKeys;
+  RSS20::Deduplicator::Prefer dedupPrefer = RSS20::Deduplicator::Prefer::Newest;
+  bool hasDedupPrefer = false;
+  bool incremental = false;
+  bool daemon = false;
+  bool serve = false;
+  std::string serverAddress;
+  uint16_t serverPort = 0;
+  unsigned int interval = 0;
+  AtomicFile::Sync sync = AtomicFile::Sync::File;
+  bool hasSync = false;
+  bool gzipCopy = false;
+  std::string cacheDirectory;
+  std::string jobFileName;
 
   if ((argc > 1) and (argv != nullptr))
   {
@@ -114,19 +911,298 @@ int main(int argc, char** argv)
           outputFileName = std::string(argv[i+1]);
           ++i; //Skip next parameter, because that is the file name we processed here.
         } //output file name
+        //job file with several merged feeds
+        else if (param == "--jobs")
+        {
+          if (!jobFileName.empty())
+          {
+            std::cerr << "Error: Job file was already set!" << std::endl;
+            return rcInvalidParameter;
+          }
+          if ((argc <= i+1) || (argv[i+1] == nullptr) || (argv[i+1][0] == '\0'))
+          {
+            std::cerr << "Error: No file name was given after " << param << "!" << std::endl;
+            return rcInvalidParameter;
+          }
+          jobFileName = std::string(argv[i+1]);
+          ++i; //Skip next parameter, because that is the file name we processed here.
+        } //job file
+        //directory for the fetch cache
+        else if (param == "--cache")
+        {
+          if (!cacheDirectory.empty())
+          {
+            std::cerr << "Error: Cache directory was already set!" << std::endl;
+            return rcInvalidParameter;
+          }
+          if ((argc <= i+1) || (argv[i+1] == nullptr) || (argv[i+1][0] == '\0'))
+          {
+            std::cerr << "Error: No directory was given after " << param << "!" << std::endl;
+            return rcInvalidParameter;
+          }
+          cacheDirectory = std::string(argv[i+1]);
+          ++i; //Skip next parameter, because that is the directory we processed here.
+        } //cache directory
+        //maximum number of concurrent transfers
+        else if (param == "--max-transfers")
+        {
+          if (maxTransfers != 0)
+          {
+            std::cerr << "Error: Maximum number of transfers was already set!" << std::endl;
+            return rcInvalidParameter;
+          }
+          if ((argc <= i+1) || (argv[i+1] == nullptr))
+          {
+            std::cerr << "Error: No number was given after " << param << "!" << std::endl;
+            return rcInvalidParameter;
+          }
+          const std::string number = std::string(argv[i+1]);
+          int value = 0;
+          if (!stringToInt(number, value) || (value <= 0))
+          {
+            std::cerr << "Error: \"" << number << "\" is not a valid number of "
+                      << "transfers. Expected a positive integer." << std::endl;
+            return rcInvalidParameter;
+          }
+          maxTransfers = static_cast<unsigned int>(value);
+          ++i; //Skip next parameter, because that is the number we processed here.
+        } //maximum number of transfers
+        //number of threads that parse the feeds
+        else if (param == "--threads")
+        {
+          if (parseThreads != 0)
+          {
+            std::cerr << "Error: Number of threads was already set!" << std::endl;
+            return rcInvalidParameter;
+          }
+          if ((argc <= i+1) || (argv[i+1] == nullptr))
+          {
+            std::cerr << "Error: No number was given after " << param << "!" << std::endl;
+            return rcInvalidParameter;
+          }
+          const std::string number = std::string(argv[i+1]);
+          int value = 0;
+          if (!stringToInt(number, value) || (value <= 0))
+          {
+            std::cerr << "Error: \"" << number << "\" is not a valid number of "
+                      << "threads. Expected a positive integer." << std::endl;
+            return rcInvalidParameter;
+          }
+          parseThreads = static_cast<unsigned int>(value);
+          ++i; //Skip next parameter, because that is the number we processed here.
+        } //number of threads
+        //maximum number of items in the merged feed
+        else if (param == "--max-items")
+        {
+          if (maxItems != 0)
+          {
+            std::cerr << "Error: Maximum number of items was already set!" << std::endl;
+            return rcInvalidParameter;
+          }
+          if ((argc <= i+1) || (argv[i+1] == nullptr))
+          {
+            std::cerr << "Error: No number was given after " << param << "!" << std::endl;
+            return rcInvalidParameter;
+          }
+          const std::string number = std::string(argv[i+1]);
+          int value = 0;
+          if (!stringToInt(number, value) || (value <= 0))
+          {
+            std::cerr << "Error: \"" << number << "\" is not a valid number of "
+                      << "items. Expected a positive integer." << std::endl;
+            return rcInvalidParameter;
+          }
+          maxItems = static_cast<std::size_t>(value);
+          ++i; //Skip next parameter, because that is the number we processed here.
+        } //maximum number of items
+        //oldest publication date of items in the merged feed
+        else if (param == "--since")
+        {
+          if (since != RSS20::Channel::NoDate)
+          {
+            std::cerr << "Error: Date for --since was already set!" << std::endl;
+            return rcInvalidParameter;
+          }
+          if ((argc <= i+1) || (argv[i+1] == nullptr))
+          {
+            std::cerr << "Error: No date was given after " << param << "!" << std::endl;
+            return rcInvalidParameter;
+          }
+          const std::string date = std::string(argv[i+1]);
+          if (!rfc822DateTimeToTimeT(date, since) || (since == RSS20::Channel::NoDate))
+          {
+            std::cerr << "Error: \"" << date << "\" is not a valid date. Expected "
+                      << "a date like \"Sun, 01 Mar 2026 00:00:00 GMT\"." << std::endl;
+            return rcInvalidParameter;
+          }
+          ++i; //Skip next parameter, because that is the date we processed here.
+        } //since date
+        //removal of duplicate items
+        else if (param == "--dedup")
+        {
+          if (!dedupKeys.empty())
+          {
+            std::cerr << "Error: Keys for --dedup were already set!" << std::endl;
+            return rcInvalidParameter;
+          }
+          if ((argc <= i+1) || (argv[i+1] == nullptr))
+          {
+            std::cerr << "Error: No keys were given after " << param << "!" << std::endl;
+            return rcInvalidParameter;
+          }
+          const std::string keys = std::string(argv[i+1]);
+          if (!RSS20::Deduplicator::keysFromString(keys, dedupKeys))
+          {
+            std::cerr << "Error: \"" << keys << "\" is not a valid list of keys. "
+                      << "Expected a comma-separated list of guid, link and title."
+                      << std::endl;
+            return rcInvalidParameter;
+          }
+          ++i; //Skip next parameter, because that is the list we processed here.
+        } //dedup
+        //which copy of duplicate items is kept
+        else if (param == "--dedup-prefer")
+        {
+          if (hasDedupPrefer)
+          {
+            std::cerr << "Error: Copy for --dedup-prefer was already set!" << std::endl;
+            return rcInvalidParameter;
+          }
+          if ((argc <= i+1) || (argv[i+1] == nullptr))
+          {
+            std::cerr << "Error: No copy was given after " << param << "!" << std::endl;
+            return rcInvalidParameter;
+          }
+          const std::string copy = std::string(argv[i+1]);
+          if (!RSS20::Deduplicator::preferFromString(copy, dedupPrefer))
+          {
+            std::cerr << "Error: \"" << copy << "\" is not a valid copy for "
+                      << param << ". Expected newest or first." << std::endl;
+            return rcInvalidParameter;
+          }
+          hasDedupPrefer = true;
+          ++i; //Skip next parameter, because that is the copy we processed here.
+        } //dedup-prefer
+        //incremental merge
+        else if (param == "--incremental")
+        {
+          if (incremental)
+          {
+            std::cerr << "Error: Parameter " << param << " was given more than once!" << std::endl;
+            return rcInvalidParameter;
+          }
+          incremental = true;
+        } //incremental
+        //daemon mode
+        else if (param == "--daemon")
+        {
+          if (daemon)
+          {
+            std::cerr << "Error: Parameter " << param << " was given more than once!" << std::endl;
+            return rcInvalidParameter;
+          }
+          daemon = true;
+        } //daemon
+        //embedded HTTP server
+        else if (param == "--serve")
+        {
+          if (serve)
+          {
+            std::cerr << "Error: Parameter " << param << " was given more than once!" << std::endl;
+            return rcInvalidParameter;
+          }
+          if ((argc <= i+1) || (argv[i+1] == nullptr))
+          {
+            std::cerr << "Error: No port was given after " << param << "!" << std::endl;
+            return rcInvalidParameter;
+          }
+          const std::string listen = std::string(argv[i+1]);
+          if (!FeedServer::parseListenAddress(listen, serverAddress, serverPort))
+          {
+            std::cerr << "Error: \"" << listen << "\" is not a valid listen address. "
+                      << "Expected a port like 8080 or an IPv4 address and a port "
+                      << "like 0.0.0.0:8080." << std::endl;
+            return rcInvalidParameter;
+          }
+          serve = true;
+          ++i; //Skip next parameter, because that is the address we processed here.
+        } //serve
+        //refresh interval of the daemon
+        else if (param == "--interval")
+        {
+          if (interval != 0)
+          {
+            std::cerr << "Error: Refresh interval was already set!" << std::endl;
+            return rcInvalidParameter;
+          }
+          if ((argc <= i+1) || (argv[i+1] == nullptr))
+          {
+            std::cerr << "Error: No number was given after " << param << "!" << std::endl;
+            return rcInvalidParameter;
+          }
+          const std::string number = std::string(argv[i+1]);
+          int value = 0;
+          if (!stringToInt(number, value) || (value <= 0))
+          {
+            std::cerr << "Error: \"" << number << "\" is not a valid number of "
+                      << "seconds. Expected a positive integer." << std::endl;
+            return rcInvalidParameter;
+          }
+          interval = static_cast<unsigned int>(value);
+          ++i; //Skip next parameter, because that is the number we processed here.
+        } //interval
+        //flushing of the output file to the disk
+        else if (param == "--sync")
+        {
+          if (hasSync)
+          {
+            std::cerr << "Error: Sync policy was already set!" << std::endl;
+            return rcInvalidParameter;
+          }
+          if ((argc <= i+1) || (argv[i+1] == nullptr))
+          {
+            std::cerr << "Error: No policy was given after " << param << "!" << std::endl;
+            return rcInvalidParameter;
+          }
+          const std::string policy = std::string(argv[i+1]);
+          if (!AtomicFile::syncFromString(policy, sync))
+          {
+            std::cerr << "Error: \"" << policy << "\" is not a valid sync policy. "
+                      << "Expected none, file or full." << std::endl;
+            return rcInvalidParameter;
+          }
+          hasSync = true;
+          ++i; //Skip next parameter, because that is the policy we processed here.
+        } //sync
+        //compressed copy of the output file
+        else if (param == "--gzip")
+        {
+          if (gzipCopy)
+          {
+            std::cerr << "Error: Parameter " << param << " was given more than once!" << std::endl;
+            return rcInvalidParameter;
+          }
+          gzipCopy = true;
+        } //gzip
         //URL for next feed?
-        else if ((param.substr(0, 7) == "http://")
-                or (param.substr(0, 8) == "https://")
-                or (param.substr(0, 6) == "ftp://"))
+        else if (isFeedURL(param))
         {
-          if (feedURLs.find(param) != feedURLs.end())
+          if (knownURLs.find(param) != knownURLs.end())
           {
             std::cerr << "Error: feed URL " << param
                       << " was given more than once!" << std::endl;
             return rcInvalidParameter;
           }
-          feedURLs.insert(param);
+          knownURLs.insert(param);
+          feedURLs.push_back(param);
         } //URL
+        //local feed file or directory with feed files?
+        else if (!param.empty() && (param[0] != '-')
+                 && std::filesystem::exists(param, fsError))
+        {
+          if (!addLocalFeeds(param, feedFiles, knownFiles))
+            return rcInvalidParameter;
+        } //local feeds
         else
         {
           //unknown or wrong parameter
@@ -144,8 +1220,27 @@ int main(int argc, char** argv)
     } //while
   } //if arguments present
 
+  const std::size_t feedCount = feedURLs.size() + feedFiles.size();
+  //The job file specifies feeds, outputs and limits of every merged feed.
+  std::vector<JobFile::Job> mergeJobs;
+  if (!jobFileName.empty())
+  {
+    if ((feedCount != 0) || !outputFileName.empty() || (maxItems != 0)
+        || (since != RSS20::Channel::NoDate) || !dedupKeys.empty() || hasDedupPrefer
+        || incremental
+        || daemon || serve || (interval != 0))
+    {
+      std::cerr << "Error: --jobs cannot be combined with feeds, --output, "
+                << "--max-items, --since, --dedup, --dedup-prefer, --incremental, --daemon, "
+                << "--serve or --interval. Put feeds and limits into the job "
+                << "file instead." << std::endl;
+      return rcInvalidParameter;
+    }
+    if (!JobFile::fromFile(jobFileName, mergeJobs))
+      return rcInvalidParameter;
+  }
   //Are there any feeds at all?
-  if (feedURLs.empty())
+  else if (feedCount == 0)
   {
     std::cerr << "Error: No feeds are specified. See valid options by typing "
               << std::endl << "    " << argv[0] << " --help" << std::endl
@@ -153,95 +1248,196 @@ int main(int argc, char** argv)
     return rcInvalidParameter;
   }
   //One feed is useless, no merge required.
-  if (feedURLs.size() == 1)
+  else if (feedCount == 1)
   {
     std::cerr << "Error: You specified just one feed, but at least two feeds "
               << "are needed to perform a merge." << std::endl;
     return rcInvalidParameter;
   }
 
-  //Check, whether output file name was set.
-  if (outputFileName.empty())
+  //Check, whether output file name was set. The server and jobs do not need it.
+  if (outputFileName.empty() && !serve && mergeJobs.empty())
   {
-    std::cout << "Info: Output file name will be set to " << cDefaultOutputFileName
+    std::cerr << "Info: Output file name will be set to " << cDefaultOutputFileName
               << ", because no file name was specified." << std::endl;
     outputFileName = cDefaultOutputFileName;
   }
 
-  std::vector<std::string> feedSources;
+  const bool toStandardOutput = (outputFileName == cStandardOutputName);
+  if (incremental && toStandardOutput)
+  {
+    std::cerr << "Error: --incremental needs an output file, because it merges "
+              << "into the previously merged feed." << std::endl;
+    return rcInvalidParameter;
+  }
+  if (toStandardOutput && (gzipCopy || hasSync))
+  {
+    std::cerr << "Error: --gzip and --sync need an output file." << std::endl;
+    return rcInvalidParameter;
+  }
+  //Serving the feed only makes sense while it is kept up to date.
+  daemon = daemon || serve;
+  if (daemon && (incremental || toStandardOutput))
+  {
+    std::cerr << "Error: --daemon and --serve cannot be combined with --incremental or an "
+              << "output to the standard output." << std::endl;
+    return rcInvalidParameter;
+  }
+  if ((interval != 0) && !daemon)
+  {
+    std::cerr << "Error: --interval can only be used together with --daemon." << std::endl;
+    return rcInvalidParameter;
+  }
+  if (interval == 0)
+    interval = cDefaultInterval;
+
+  if (maxTransfers == 0)
+    maxTransfers = cDefaultMaxTransfers;
+  if (parseThreads == 0)
+    parseThreads = hardwareThreads();
 
-  //Get all the feeds via cURL.
-  for (const auto & item : feedURLs)
+  //libxml2 has to be initialized once, before any thread uses it.
+  xmlInitParser();
+
+  /* An incremental merge starts with the result of the previous run. New
+     items are merged into it, and items of unchanged feeds are in there
+     already. */
+  RSS20::Channel previousFeed;
+  bool hasPreviousFeed = false;
+  if (incremental)
   {
-    Curly cURL;
-    cURL.setURL(item);
-    //Allow cURL to follow redirects, ...
-    cURL.followRedirects(true);
-    /* ... but only up to three. That should be more than enough for most
-       sanely configured servers and avoids endless redirect loops. */
-    cURL.setMaximumRedirects(3);
-    std::string sourceOfFeed;
-    if (!cURL.perform(sourceOfFeed))
-    {
-      std::cerr << "Error: Unable to retrieve feed from " << item << "!"
-                << std::endl;
-      return rcNetworkError;
-    } //if
-    if (cURL.getResponseCode() != 200)
+    std::error_code error;
+    if (!std::filesystem::is_regular_file(outputFileName, error))
     {
-      std::cerr << "Error: Retrieving feed from " << item << " returned "
-                << "unexpected response code " << cURL.getResponseCode()
-                << ". Expected: 200." << std::endl;
-      return rcNetworkError;
+      std::cerr << "Info: There is no previously merged feed in " << outputFileName
+                << " yet, so all feeds are merged from scratch." << std::endl;
     }
-    if (sourceOfFeed.empty())
+    else if (!RSS20::Parser::fromFile(outputFileName, previousFeed))
     {
-      std::cerr << "Error: Getting URL " << item << " returned empty result!"
+      std::cerr << "Warning: Could not parse the previously merged feed in "
+                << outputFileName << ", so all feeds are merged from scratch."
                 << std::endl;
-      return rcNetworkError;
+      previousFeed = RSS20::Channel();
     }
-    feedSources.push_back(sourceOfFeed);
-  } //for
+    else
+      hasPreviousFeed = true;
+    //Feeds overlap with the previous result, so duplicates have to go.
+    if (dedupKeys.empty())
+      dedupKeys = RSS20::Deduplicator().keys();
+  } //if incremental
+  if (hasDedupPrefer && dedupKeys.empty())
+    dedupKeys = RSS20::Deduplicator().keys();
 
-  //Parse feed sources into RSS 2.0 feeds.
-  /* TODO: Support Atom feeds, too! */
+  FetchCache cache(cacheDirectory);
+  const bool useCache = !cacheDirectory.empty();
+  if (useCache && !cache.create())
+    return rcFileError;
 
+  LoadSettings settings;
+  settings.maxTransfers = maxTransfers;
+  settings.parseThreads = parseThreads;
+  settings.cache = useCache ? &cache : nullptr;
+  MergeSettings mergeSettings;
+  mergeSettings.maxItems = maxItems;
+  mergeSettings.since = since;
+  mergeSettings.dedupKeys = dedupKeys;
+  mergeSettings.dedupPrefer = dedupPrefer;
+  if (!mergeJobs.empty())
+    return runJobs(mergeJobs, settings, sync, gzipCopy);
+  if (daemon)
+  {
+    FeedServer server;
+    if (serve)
+    {
+      if (!server.start(serverAddress, serverPort))
+        return rcNetworkError;
+      std::cerr << "Info: Serving the merged feed at http://" << serverAddress
+                << ":" << server.port() << "/." << std::endl;
+    }
+    return runDaemon(feedURLs, feedFiles, settings, mergeSettings, interval,
+                     outputFileName, sync, gzipCopy, serve ? &server : nullptr);
+  }
+
+  //Get all the feeds via cURL, several of them at the same time.
+  //The pool lets transfers to the same host share DNS and TLS session data.
+  CurlyHandlePool handlePool;
+  std::vector<ParseJob> jobs;
   std::vector<RSS20::Channel> feeds;
-  for (const auto & feedSrc : feedSources)
+  /* No need to load unchanged feeds, if their items are in the previous
+     result. The merge record tells which versions of the feeds that are. */
+  std::vector<FetchCache::Entry> knownVersions(feedURLs.size());
+  std::vector<FetchCache::Entry> mergedVersions;
+  if (hasPreviousFeed && useCache && cache.loadMergeRecord(outputFileName, mergedVersions))
   {
-    RSS20::Channel feed;
-    #ifdef DEBUG
-    std::cout << "Parsing feed ..." << std::endl;
-    #endif // DEBUG
-    if (!RSS20::Parser::fromString(feedSrc, feed))
+    for (std::size_t idx = 0; idx < feedURLs.size(); ++idx)
     {
-      std::cerr << "Error: Could not parse the data from one feed as RSS 2.0!"
-                << std::endl;
-      return rcParserError;
+      const auto iter = std::find_if(mergedVersions.begin(), mergedVersions.end(),
+          [&feedURLs, idx](const FetchCache::Entry& entry) { return entry.url == feedURLs[idx]; });
+      if (iter != mergedVersions.end())
+        knownVersions[idx] = *iter;
+    } //for
+  }
+  if (!loadFeeds(feedURLs, knownVersions, feedFiles, settings, handlePool, jobs, feeds))
+  {
+    std::cerr << "Error: Unable to retrieve the feeds!" << std::endl;
+    return rcNetworkError;
+  }
+  //Report errors in input order.
+  for (const auto& job : jobs)
+  {
+    if (job.returnCode != 0)
+    {
+      std::cerr << job.error << std::endl;
+      return job.returnCode;
     }
-    feeds.push_back(feed);
   } //for
+  //Feeds that have not changed do not contribute anything new.
+  std::size_t unchangedFeeds = 0;
+  for (std::size_t idx = jobs.size(); idx > 0; --idx)
+  {
+    if (jobs[idx - 1].kind == ParseJob::Kind::Unchanged)
+    {
+      feeds.erase(feeds.begin() + (idx - 1));
+      ++unchangedFeeds;
+    }
+  } //for
+  if (hasPreviousFeed)
+  {
+    std::cerr << "Info: " << unchangedFeeds << " of " << feedCount
+              << " feed(s) did not change since the last run." << std::endl;
+    //The previous result comes last, so fresh copies of items win.
+    feeds.push_back(std::move(previousFeed));
+  }
 
   //create merged feed object
   RSS20::Channel mergedFeed;
-  if (!RSS20::Merger::merge(feeds, mergedFeed))
-  {
-    std::cout << "Something wet wrong while merging the feeds!" << std::endl;
+  if (!mergeFeeds(std::move(feeds), feedCount, mergeSettings, mergedFeed))
     return rcMergeError;
-  }
-  //Set name of generator.
-  mergedFeed.setGenerator(cVersionStringGenerator);
-  //sort items
-  auto allItems = mergedFeed.items();
-  std::sort(allItems.begin(), allItems.end(), std::greater<RSS20::Item>());
-  mergedFeed.setItems(allItems);
 
+  //Write merged feed to the standard output, e.g. for a pipe.
+  if (toStandardOutput)
+  {
+    if (!RSS20::Writer::toStream(mergedFeed, std::cout))
+    {
+      std::cerr << "Error: Could not write feed to standard output!" << std::endl;
+      return rcFileError;
+    }
+    return 0;
+  }
   //Write merged feed to a file.
-  if (!RSS20::Writer::toFile(mergedFeed, outputFileName))
+  if (!RSS20::Writer::toFile(mergedFeed, outputFileName, sync, gzipCopy))
   {
     std::cerr << "Error: Could not write feed to " << outputFileName << "!" << std::endl;
     return rcFileError;
   }
+  //Only now the feed versions are in the output, so the next run may skip them.
+  if (useCache)
+  {
+    mergedVersions.clear();
+    for (std::size_t idx = 0; idx < feedURLs.size(); ++idx)
+      mergedVersions.push_back(jobs[idx].version);
+    cache.storeMergeRecord(outputFileName, mergedVersions);
+  }
 
   //Feed was written to file, we are done here.
   return 0;
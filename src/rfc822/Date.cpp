@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the feed merger.
-    Copyright (C) 2015  Dirk Stolle
+    Copyright (C) 2015, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -19,10 +19,221 @@
 */
 
 #include "Date.hpp"
+#include <cstdint>
 #include <cstring>
-#include "../StringFunctions.hpp"
+#include <limits>
 
-bool rfc822DateTimeToTimeT(const std::string& rfcDate, std::time_t& output)
+/* Packs up to three characters into one integer, so that short names like
+   days, months and time zones can be looked up with a single switch. */
+static constexpr std::uint32_t pack(const char a, const char b, const char c)
+{
+  return (static_cast<std::uint32_t>(static_cast<unsigned char>(a)) << 16)
+       | (static_cast<std::uint32_t>(static_cast<unsigned char>(b)) << 8)
+       | static_cast<std::uint32_t>(static_cast<unsigned char>(c));
+}
+
+static std::uint32_t pack(const std::string_view name)
+{
+  return pack(name[0], name[1], name[2]);
+}
+
+/* Splits text at the separator in the same way as splitAtSeparator(), but
+   only stores views of the first maxParts parts instead of copies of all of
+   them. Returns the total number of parts. */
+static std::size_t splitView(const std::string_view text, const char separator,
+                             std::string_view* parts, const std::size_t maxParts)
+{
+  if (text.empty())
+  {
+    parts[0] = text;
+    return 1;
+  }
+  std::size_t count = 0;
+  std::size_t start = 0;
+  while (start < text.size())
+  {
+    std::size_t pos = text.find(separator, start);
+    if (pos == std::string_view::npos)
+      pos = text.size();
+    if (count < maxParts)
+      parts[count] = text.substr(start, pos - start);
+    ++count;
+    start = pos + 1;
+  } //while
+  return count;
+}
+
+/* Converts a non-empty sequence of decimal digits to an unsigned value, just
+   like stringToUnsignedInt() does, but without a copy of the digits. */
+static bool digitsToUnsigned(const std::string_view digits, unsigned int& value)
+{
+  if (digits.empty())
+    return false;
+  const unsigned int cTenthLimit = std::numeric_limits<unsigned int>::max() / 10;
+  const unsigned int cRealLimit = std::numeric_limits<unsigned int>::max();
+  value = 0;
+  for (const char c : digits)
+  {
+    if ((c < '0') || (c > '9'))
+      return false;
+    if (value > cTenthLimit)
+      return false;
+    value = value * 10;
+    const unsigned int digit = static_cast<unsigned int>(c - '0');
+    if (value > cRealLimit - digit)
+      return false;
+    value = value + digit;
+  } //for
+  return true;
+}
+
+/* Gets the number of the month (1 - 12) from its abbreviated name. Returns
+   zero for unknown names. */
+static unsigned int monthFromName(const std::string_view name)
+{
+  if (name.size() != 3)
+    return 0;
+  switch (pack(name))
+  {
+    case pack('J', 'a', 'n'): return 1;
+    case pack('F', 'e', 'b'): return 2;
+    case pack('M', 'a', 'r'): return 3;
+    case pack('A', 'p', 'r'): return 4;
+    case pack('M', 'a', 'y'): return 5;
+    case pack('J', 'u', 'n'): return 6;
+    case pack('J', 'u', 'l'): return 7;
+    case pack('A', 'u', 'g'): return 8;
+    case pack('S', 'e', 'p'): return 9;
+    case pack('O', 'c', 't'): return 10;
+    case pack('N', 'o', 'v'): return 11;
+    case pack('D', 'e', 'c'): return 12;
+    default: return 0;
+  } //switch
+}
+
+/* Checks whether the first three characters of text are the abbreviated
+   name of a day of the week. */
+static bool isDayOfWeek(const std::string_view text)
+{
+  if (text.size() < 3)
+    return false;
+  switch (pack(text))
+  {
+    case pack('M', 'o', 'n'):
+    case pack('T', 'u', 'e'):
+    case pack('W', 'e', 'd'):
+    case pack('T', 'h', 'u'):
+    case pack('F', 'r', 'i'):
+    case pack('S', 'a', 't'):
+    case pack('S', 'u', 'n'):
+         return true;
+    default:
+         return false;
+  } //switch
+}
+
+/* Gets the offset of a time zone in seconds.
+
+   zone        =  "UT"  / "GMT"                ; Universal Time
+                                               ; North American : UT
+               /  "EST" / "EDT"                ;  Eastern:  - 5/ - 4
+               /  "CST" / "CDT"                ;  Central:  - 6/ - 5
+               /  "MST" / "MDT"                ;  Mountain: - 7/ - 6
+               /  "PST" / "PDT"                ;  Pacific:  - 8/ - 7
+               /  1ALPHA                       ; Military: Z = UT;
+                                               ;  A:-1; (J not used)
+                                               ;  M:-12; N:+1; Y:+12
+               / ( ("+" / "-") 4DIGIT )        ; Local differential
+                                               ;  hours+min. (HHMM) */
+static bool zoneOffset(const std::string_view zone, int& offset)
+{
+  const int hour = 60 * 60;
+  switch (zone.size())
+  {
+    case 1:
+         //military zones, J is not in use
+         if ((zone[0] >= 'A') && (zone[0] <= 'I'))
+           offset = -(zone[0] - 'A' + 1) * hour;
+         else if ((zone[0] >= 'K') && (zone[0] <= 'M'))
+           offset = -(zone[0] - 'K' + 10) * hour;
+         else if ((zone[0] >= 'N') && (zone[0] <= 'Y'))
+           offset = (zone[0] - 'N' + 1) * hour;
+         else
+           return false;
+         return true;
+    case 2:
+         //not UTC, but UT!
+         offset = 0;
+         return (zone[0] == 'U') && (zone[1] == 'T');
+    case 3:
+         switch (pack(zone))
+         {
+           case pack('G', 'M', 'T'): offset = 0; return true;
+           case pack('E', 'S', 'T'): offset = -5 * hour; return true;
+           case pack('E', 'D', 'T'): offset = -4 * hour; return true;
+           case pack('C', 'S', 'T'): offset = -6 * hour; return true;
+           case pack('C', 'D', 'T'): offset = -5 * hour; return true;
+           case pack('M', 'S', 'T'): offset = -7 * hour; return true;
+           case pack('M', 'D', 'T'): offset = -6 * hour; return true;
+           case pack('P', 'S', 'T'): offset = -8 * hour; return true;
+           case pack('P', 'D', 'T'): offset = -7 * hour; return true;
+           default: return false;
+         } //switch
+    case 5:
+         {
+           unsigned int offHours = 0;
+           if (!digitsToUnsigned(zone.substr(1, 2), offHours) || (offHours > 12))
+             return false;
+           unsigned int offMinutes = 0;
+           if (!digitsToUnsigned(zone.substr(3, 2), offMinutes) || (offMinutes > 59))
+             return false;
+           offset = offHours * hour + offMinutes * 60;
+           if (zone[0] == '-')
+             offset = -offset;
+           else if (zone[0] != '+')
+             return false;
+           return true;
+         }
+    default:
+         // invalid timezone / offset specification
+         return false;
+  } //switch
+}
+
+/* Returns the number of days between 1970-01-01 and the given date of the
+   proleptic Gregorian calendar. Days beyond the end of the month just count
+   on into the next month, like std::mktime() does it. */
+static std::int64_t daysFromCivil(std::int64_t year, const unsigned int month,
+                                  const unsigned int day)
+{
+  //The year starts in March here, so the leap day is the last day.
+  if (month <= 2)
+    year -= 1;
+  const std::int64_t era = (year >= 0 ? year : year - 399) / 400;
+  const std::int64_t yearOfEra = year - era * 400;
+  const std::int64_t dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+  const std::int64_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+  return era * 146097 + dayOfEra - 719468;
+}
+
+/* Converts a local date and time, given as seconds since the epoch as if the
+   local time zone was UTC, to a time_t value. That is what std::mktime()
+   does with tm_isdst = -1, but without normalising a std::tm first. */
+static bool localToTimeT(const std::int64_t local, std::time_t& output)
+{
+  struct std::tm parts;
+  std::time_t t = static_cast<std::time_t>(local);
+  if (localtime_r(&t, &parts) == nullptr)
+    return false;
+  t = static_cast<std::time_t>(local - parts.tm_gmtoff);
+  //The offset may be different at the result, e.g. near a change to DST.
+  if (localtime_r(&t, &parts) == nullptr)
+    return false;
+  output = static_cast<std::time_t>(local - parts.tm_gmtoff);
+  return true;
+}
+
+bool rfc822DateTimeToTimeT(const std::string_view rfcDate, std::time_t& output)
 {
   if (rfcDate.empty())
     return false;
@@ -68,65 +279,34 @@ bool rfc822DateTimeToTimeT(const std::string& rfcDate, std::time_t& output)
                                                  ;  hours+min. (HHMM)
 */
 
+  std::string_view workString = rfcDate;
   //Day of week is optional.
-  const bool containsDayOfWeek = rfcDate.find(',') != std::string::npos;
-  if (containsDayOfWeek)
+  if (rfcDate.find(',') != std::string_view::npos)
   {
-    const std::string dayOfWeek = rfcDate.substr(0,3);
-    //check, if day is valid
-    if ((dayOfWeek != "Mon") && (dayOfWeek != "Tue") && (dayOfWeek != "Wed")
-        && (dayOfWeek != "Thu") && (dayOfWeek != "Fri") && (dayOfWeek != "Sat")
-        && (dayOfWeek != "Sun"))
+    if (!isDayOfWeek(rfcDate))
       return false;
+    //The comma follows the day, so there are at least four characters.
+    workString.remove_prefix(4);
   } //if day of week is present
-
-  //Use copy of parameter to work with it.
-  std::string workString = (containsDayOfWeek) ? rfcDate.substr(4) : rfcDate;
   //Remove leading space(s).
-  while (!workString.empty() && workString.at(0) == ' ')
-    workString.erase(0, 1);
-
-  const auto parts = splitAtSeparator(workString, ' ');
+  while (!workString.empty() && workString[0] == ' ')
+    workString.remove_prefix(1);
 
-  if (parts.size() != 5)
+  std::string_view parts[5];
+  if (splitView(workString, ' ', parts, 5) != 5)
     return false;
 
   unsigned int dayOfMonth = 0;
-  if (!stringToUnsignedInt(parts[0], dayOfMonth))
+  if (!digitsToUnsigned(parts[0], dayOfMonth))
     return false;
   if ((dayOfMonth <= 0) || (dayOfMonth > 31))
     return false;
-  const std::string strMonth = parts[1];
-  unsigned int month = 0;
-  if (strMonth == "Jan")
-    month = 1;
-  else if (strMonth == "Feb")
-    month = 2;
-  else if (strMonth == "Mar")
-    month = 3;
-  else if (strMonth == "Apr")
-    month = 4;
-  else if (strMonth == "May")
-    month = 5;
-  else if (strMonth == "Jun")
-    month = 6;
-  else if (strMonth == "Jul")
-    month = 7;
-  else if (strMonth == "Aug")
-    month = 8;
-  else if (strMonth == "Sep")
-    month = 9;
-  else if (strMonth == "Oct")
-    month = 10;
-  else if (strMonth == "Nov")
-    month = 11;
-  else if (strMonth == "Dec")
-    month = 12;
-  else
+  const unsigned int month = monthFromName(parts[1]);
+  if (month == 0)
     return false;
 
   unsigned int year = 0;
-  if (!stringToUnsignedInt(parts[2], year))
+  if (!digitsToUnsigned(parts[2], year))
     return false;
   /* Convert two digit years to four digits.
      Values greater or equal to 70 will be interpreted as 1970 - 1999.
@@ -141,122 +321,41 @@ bool rfc822DateTimeToTimeT(const std::string& rfcDate, std::time_t& output)
   } //if only two digits (or less)
 
   //Parse time of the day.
-  const auto timeParts = splitAtSeparator(parts[3], ':');
+  std::string_view timeParts[3];
+  const std::size_t timePartCount = splitView(parts[3], ':', timeParts, 3);
   //At least hours and minutes are required.
-  if (timeParts.size() < 2)
+  if (timePartCount < 2)
     return false;
   unsigned int hour = 25;
-  if (!stringToUnsignedInt(timeParts[0], hour))
+  if (!digitsToUnsigned(timeParts[0], hour))
     return false;
   if (hour >= 24)
     return false;
   unsigned int minute = 61;
-  if (!stringToUnsignedInt(timeParts[1], minute))
+  if (!digitsToUnsigned(timeParts[1], minute))
     return false;
   if (minute >= 60)
     return false;
-  unsigned int second = 61;
+  unsigned int second = 0;
   //Seconds are optional, so they may or may not be present.
-  if (timeParts.size() >= 3)
+  if (timePartCount >= 3)
   {
-    if (!stringToUnsignedInt(timeParts[2], second))
+    if (!digitsToUnsigned(timeParts[2], second))
       return false;
     if (second >= 60)
       return false;
   }
-  else
-    second = 0;
 
-  /* zone        =  "UT"  / "GMT"                ; Universal Time
-                                                 ; North American : UT
-                 /  "EST" / "EDT"                ;  Eastern:  - 5/ - 4
-                 /  "CST" / "CDT"                ;  Central:  - 6/ - 5
-                 /  "MST" / "MDT"                ;  Mountain: - 7/ - 6
-                 /  "PST" / "PDT"                ;  Pacific:  - 8/ - 7
-                 /  1ALPHA                       ; Military: Z = UT;
-                                                 ;  A:-1; (J not used)
-                                                 ;  M:-12; N:+1; Y:+12
-                 / ( ("+" / "-") 4DIGIT )        ; Local differential
-                                                 ;  hours+min. (HHMM) */
-
-  //time offset
-  int offset = 0; //offset in seconds
-  if (parts[4] == "GMT" || parts[4] == "UT" /* not UTC, but UT!*/)
-    offset = 0;
-  else if (parts[4] == "EST") offset = -5 * 60 * 60;
-  else if (parts[4] == "EDT") offset = -4 * 60 * 60;
-  else if (parts[4] == "CST") offset = -6 * 60 * 60;
-  else if (parts[4] == "CDT") offset = -5 * 60 * 60;
-  else if (parts[4] == "MST") offset = -7 * 60 * 60;
-  else if (parts[4] == "MDT") offset = -6 * 60 * 60;
-  else if (parts[4] == "PST") offset = -8 * 60 * 60;
-  else if (parts[4] == "PDT") offset = -7 * 60 * 60;
-  else if (parts[4] == "A") offset = -1 * 60 * 60;
-  else if (parts[4] == "B") offset = -2 * 60 * 60;
-  else if (parts[4] == "C") offset = -3 * 60 * 60;
-  else if (parts[4] == "D") offset = -4 * 60 * 60;
-  else if (parts[4] == "E") offset = -5 * 60 * 60;
-  else if (parts[4] == "F") offset = -6 * 60 * 60;
-  else if (parts[4] == "G") offset = -7 * 60 * 60;
-  else if (parts[4] == "H") offset = -8 * 60 * 60;
-  else if (parts[4] == "I") offset = -9 * 60 * 60;
-  // J not in use
-  else if (parts[4] == "K") offset = -10 * 60 * 60;
-  else if (parts[4] == "L") offset = -11 * 60 * 60;
-  else if (parts[4] == "M") offset = -12 * 60 * 60;
-  else if (parts[4] == "N") offset = +1 * 60 * 60;
-  else if (parts[4] == "O") offset = +2 * 60 * 60;
-  else if (parts[4] == "P") offset = +3 * 60 * 60;
-  else if (parts[4] == "Q") offset = +4 * 60 * 60;
-  else if (parts[4] == "R") offset = +5 * 60 * 60;
-  else if (parts[4] == "S") offset = +6 * 60 * 60;
-  else if (parts[4] == "T") offset = +7 * 60 * 60;
-  else if (parts[4] == "U") offset = +8 * 60 * 60;
-  else if (parts[4] == "V") offset = +9 * 60 * 60;
-  else if (parts[4] == "W") offset = +10 * 60 * 60;
-  else if (parts[4] == "X") offset = +11 * 60 * 60;
-  else if (parts[4] == "Y") offset = +12 * 60 * 60;
-  else if (parts[4].size() == 5)
-  {
-    unsigned int offHours = 0;
-    if (!stringToUnsignedInt(parts[4].substr(1,2), offHours))
-      return false;
-    if (offHours > 12)
-      return false;
-    unsigned int offMinutes = 0;
-    if (!stringToUnsignedInt(parts[4].substr(3,2), offMinutes))
-      return false;
-    if (offMinutes > 59)
-      return false;
-    offset = offHours * 60 * 60 + offMinutes * 60;
-    if (parts[4].at(0) == '-')
-      offset = -offset;
-    else if (parts[4].at(0) != '+')
-      return false;
-  } //else
-  else
-    // invalid timezone / offset specification
+  /* The zone has to be valid, but its offset is not applied: the date is
+     interpreted as local time, and timeToRFC822String() writes local time,
+     too, so that both functions agree. */
+  int offset = 0;
+  if (!zoneOffset(parts[4], offset))
     return false;
 
-  //put data into std::tm
-  struct tm timeStructure;
-  std::memset(&timeStructure, 0, sizeof(struct tm));
-
-  timeStructure.tm_year = year - 1900; //years since 1900
-  timeStructure.tm_mon = month - 1; //months since January
-  timeStructure.tm_mday = dayOfMonth;
-  timeStructure.tm_hour = hour;
-  timeStructure.tm_min = minute;
-  timeStructure.tm_sec = second;
-  timeStructure.tm_gmtoff = offset;
-  timeStructure.tm_isdst = -1; //no information on DST
-
-  const std::time_t tt = std::mktime(&timeStructure);
-  // Return value -1 means failure of mktime().
-  if (tt == -1)
-    return false;
-  output = tt;
-  return true;
+  const std::int64_t local = daysFromCivil(year, month, dayOfMonth) * 86400
+                           + hour * 3600 + minute * 60 + second;
+  return localToTimeT(local, output);
 }
 
 bool timeToRFC822String(const std::time_t t, std::string& output)
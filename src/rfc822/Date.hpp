@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the feed merger.
-    Copyright (C) 2015  Dirk Stolle
+    Copyright (C) 2015, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -23,6 +23,7 @@
 
 #include <ctime>
 #include <string>
+#include <string_view>
 
 /** \brief converts a string that follows RFC 822 date format to a time_t value
  *
@@ -31,8 +32,9 @@
  * \return Returns true, if the date could be converted properly.
  *         Returns false, if an error occurred. The content of @arg output is
  *         undefined in such a case.
+ * \remarks The date is read in a single pass without any allocations.
  */
-bool rfc822DateTimeToTimeT(const std::string& rfcDate, std::time_t& output);
+bool rfc822DateTimeToTimeT(const std::string_view rfcDate, std::time_t& output);
 
 
 /** \brief converts the given time_t value to a RFC 822 conforming date/time string
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the feed merger.
-    Copyright (C) 2015, 2017  Dirk Stolle
+    Copyright (C) 2015, 2017, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -30,7 +30,7 @@ namespace RSS091
 
 bool Parser::itemFromNode(const XMLNode& itemNode, Item& theItem)
 {
-  if (!itemNode.isElementNode() or (itemNode.getNameAsString() != "item"))
+  if (!itemNode.isElementNode() or (itemNode.getElementName() != ElementName::Item))
     return false;
 
   theItem = Item("", "", "");
@@ -40,9 +40,12 @@ bool Parser::itemFromNode(const XMLNode& itemNode, Item& theItem)
 
   XMLNode child = itemNode.getChild();
 
-  while (child.hasNextSibling())
+  while (true)
   {
     child.skipEmptyCommentAndTextSiblings();
+    //Only comments or whitespace may follow the last element.
+    if (child.isCommentNode() || child.isBlankTextNode())
+      break;
 
     if (!child.isElementNode())
     {
@@ -51,9 +54,9 @@ bool Parser::itemFromNode(const XMLNode& itemNode, Item& theItem)
       return false;
     }
 
-    const std::string nodeName = child.getNameAsString();
+    const ElementName name = child.getElementName();
 
-    if (nodeName == "title")
+    if (name == ElementName::Title)
     {
       if (!theItem.title().empty())
       {
@@ -62,7 +65,7 @@ bool Parser::itemFromNode(const XMLNode& itemNode, Item& theItem)
       } //if title was already specified
       theItem.setTitle(child.getContentBoth());
     }
-    else if (nodeName == "link")
+    else if (name == ElementName::Link)
     {
       if (!theItem.link().empty())
       {
@@ -71,7 +74,7 @@ bool Parser::itemFromNode(const XMLNode& itemNode, Item& theItem)
       } //if link was already specified
       theItem.setLink(child.getContentBoth());
     }
-    else if (nodeName == "description")
+    else if (name == ElementName::Description)
     {
       if (!theItem.description().empty())
       {
@@ -82,10 +85,12 @@ bool Parser::itemFromNode(const XMLNode& itemNode, Item& theItem)
     }
     else
     {
-      std::cerr << "Found unexpected node name within item: \"" << nodeName
+      std::cerr << "Found unexpected node name within item: \"" << child.getNameAsString()
                 << "\"!" << std::endl;
       return false;
     }
+    if (!child.hasNextSibling())
+      break;
     child = child.getNextSibling();
   } //while
   //We are done here. Item should not be empty by now.
@@ -103,11 +108,19 @@ bool Parser::fromString(const std::string& source, Channel& feed)
 {
   if (source.empty())
     return false;
-  XMLDocument doc(xmlParseDoc(reinterpret_cast<const xmlChar*>(source.c_str())));
+  return fromBuffer(source.data(), source.size(), feed);
+}
+
+bool Parser::fromBuffer(const char* data, const std::size_t size, Channel& feed,
+                        const char* encoding, const int options)
+{
+  if ((data == nullptr) || (size == 0))
+    return false;
+  const XMLDocument doc(data, size, encoding, options);
   return fromDocument(doc, feed);
 }
 
-bool Parser::fromDocument(const XMLDocument& doc, Channel& feed)
+bool Parser::fromDocument(const XMLDocumentView doc, Channel& feed)
 {
   if (!doc.isParsed())
   {
@@ -121,7 +134,7 @@ bool Parser::fromDocument(const XMLDocument& doc, Channel& feed)
     return false;
   }
   XMLNode node = doc.getRootNode();
-  if (node.getNameAsString() != "rss")
+  if (node.getElementName() != ElementName::Rss)
   {
     std::cerr << "Root element's name is not \"rss\" but \""
               << node.getNameAsString() << "\" instead." << std::endl;
@@ -151,7 +164,7 @@ bool Parser::fromDocument(const XMLDocument& doc, Channel& feed)
   //skip empty comment and text nodes
   node.skipEmptyCommentAndTextSiblings();
 
-  if (!node.isElementNode() or (node.getNameAsString() != "channel"))
+  if (!node.isElementNode() or (node.getElementName() != ElementName::Channel))
   {
     std::cerr << "Child node of <rss> node must be <channel> node! "
               << "However, node's name is " << node.getNameAsString() << "."
@@ -177,11 +190,14 @@ bool Parser::fromDocument(const XMLDocument& doc, Channel& feed)
     node.skipEmptyCommentAndTextSiblings();
     if (!node.isElementNode())
     {
-      //No more element node means we can break out of the loop
-      break;
+      //No more sibling means we can break out of the loop.
+      if (!node.hasNextSibling())
+        break;
+      node = node.getNextSibling();
+      continue;
     } //if
 
-    const std::string nodeName = node.getNameAsString();
+    const ElementName name = node.getElementName();
     bool errors = false;
     if (commonChannelElementFromNode(node, feed, errors))
     {
@@ -191,7 +207,7 @@ bool Parser::fromDocument(const XMLDocument& doc, Channel& feed)
         return false;
       } //if
     } //if common channel element was parsed
-    else if (nodeName == "item")
+    else if (name == ElementName::Item)
     {
       Item it = Item("", "", "");
       if (!itemFromNode(node, it))
@@ -201,7 +217,7 @@ bool Parser::fromDocument(const XMLDocument& doc, Channel& feed)
       }
       feed.addItem(it);
     } //if item
-    else if (nodeName == "textinput")
+    else if (name == ElementName::TextInputLowercase)
     {
       if (!feed.textInput().empty())
       {
@@ -218,7 +234,7 @@ bool Parser::fromDocument(const XMLDocument& doc, Channel& feed)
     } //if textInput
     else
     {
-      std::cerr << "Found unexpected node name in channel: \"" << nodeName << "\"!"
+      std::cerr << "Found unexpected node name in channel: \"" << node.getNameAsString() << "\"!"
                 << std::endl;
       return false;
     }
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the feed merger.
-    Copyright (C) 2015, 2017  Dirk Stolle
+    Copyright (C) 2015, 2017, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -23,10 +23,10 @@
 
 #include <string>
 #include "../basic-rss/Parser.hpp"
+#include "../xml/XMLDocument.hpp"
 #include "Item.hpp"
 
-//forward declarations
-class XMLDocument;
+//forward declaration
 class XMLNode;
 
 namespace RSS091
@@ -49,12 +49,12 @@ namespace RSS091
 
       /** \brief parses the given XML document as RSS 0.91 feed
        *
-       * \param doc   the XML document
+       * \param doc   view of the XML document, an XMLDocument converts to it
        * \param feed  variable that will be used to store the parsed result
        * \return Returns true, if the document could be parsed as RSS 0.091
        * Returns false, if the document could not be parsed.
        */
-      static bool fromDocument(const XMLDocument& doc, Channel& feed);
+      static bool fromDocument(const XMLDocumentView doc, Channel& feed);
 
 
       /** \brief parses the given string as RSS 0.91 feed
@@ -65,6 +65,24 @@ namespace RSS091
        * Returns false, if the string could not be parsed.
        */
       static bool fromString(const std::string& source, Channel& feed);
+
+
+      /** \brief parses the given memory buffer as RSS 0.91 feed
+       *
+       * \param data      pointer to the source code of the feed, does not need
+       *                  to be NUL-terminated
+       * \param size      length of the source code in bytes
+       * \param feed      variable that will be used to store the parsed result
+       * \param encoding  name of the feed's encoding, or nullptr to detect it
+       * \param options   combination of libxml2's xmlParserOption values
+       * \return Returns true, if the buffer could be parsed as RSS 0.91.
+       * Returns false, if the buffer could not be parsed.
+       * \remarks The buffer is not copied, so it may be a memory-mapped file
+       *          or the buffer of a transfer.
+       */
+      static bool fromBuffer(const char* data, const std::size_t size, Channel& feed,
+                             const char* encoding = nullptr,
+                             const int options = XMLDocument::DefaultParseOptions);
     private:
       /** \brief parses a feed item from the given XML node
        *
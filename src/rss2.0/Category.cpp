@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the feed merger.
-    Copyright (C) 2015, 2022  Dirk Stolle
+    Copyright (C) 2015, 2022, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -23,7 +23,7 @@
 namespace RSS20
 {
 
-Category::Category(const std::string& category, const std::string& domain)
+Category::Category(const std::string_view category, const std::string_view domain)
 : m_category(category),
   m_domain(domain)
 {
@@ -34,7 +34,7 @@ const std::string& Category::get() const
   return m_category;
 }
 
-void Category::setCategory(const std::string& category)
+void Category::setCategory(const std::string_view category)
 {
   m_category = category;
 }
@@ -44,7 +44,7 @@ const std::string& Category::domain() const
   return m_domain;
 }
 
-void Category::setDomain(const std::string& domain)
+void Category::setDomain(const std::string_view domain)
 {
   m_domain = domain;
 }
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the feed merger.
-    Copyright (C) 2015, 2022  Dirk Stolle
+    Copyright (C) 2015, 2022, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -22,6 +22,7 @@
 #define RSS20_CATEGORY_HPP
 
 #include <string>
+#include <string_view>
 
 namespace RSS20
 {
@@ -35,7 +36,7 @@ namespace RSS20
        * \param category  the category name
        * \param domain    value of the domain attribute, optional
        */
-      explicit Category(const std::string& category = "", const std::string& domain = "");
+      explicit Category(const std::string_view category = "", const std::string_view domain = "");
 
 
       /** \brief Gets the category's name.
@@ -50,7 +51,7 @@ namespace RSS20
        *
        * \param category  the new category name
        */
-      void setCategory(const std::string& category);
+      void setCategory(const std::string_view category);
 
 
       /** \brief Gets the category's domain.
@@ -65,7 +66,7 @@ namespace RSS20
        *
        * \param domain  the new domain of the category
        */
-      void setDomain(const std::string& domain);
+      void setDomain(const std::string_view domain);
 
 
       /** \brief Checks whether this element is empty.
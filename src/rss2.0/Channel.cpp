@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the feed merger.
-    Copyright (C) 2015, 2017  Dirk Stolle
+    Copyright (C) 2015, 2017, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -19,6 +19,7 @@
 */
 
 #include "Channel.hpp"
+#include <algorithm>
 
 namespace RSS20
 {
@@ -66,6 +67,12 @@ void Channel::addItem(const Item& item)
     m_items.push_back(item);
 }
 
+void Channel::addItem(Item&& item)
+{
+  if (!item.empty())
+    m_items.push_back(std::move(item));
+}
+
 void Channel::setItems(const std::vector<Item>& all)
 {
   m_items = all;
@@ -79,6 +86,22 @@ void Channel::setItems(const std::vector<Item>& all)
   } //for
 }
 
+void Channel::setItems(std::vector<Item>&& all)
+{
+  m_items = std::move(all);
+  //remove empty items
+  m_items.erase(std::remove_if(m_items.begin(), m_items.end(),
+                               [](const Item& i) { return i.empty(); }),
+                m_items.end());
+}
+
+std::vector<Item> Channel::takeItems()
+{
+  std::vector<Item> all;
+  all.swap(m_items);
+  return all;
+}
+
 const std::set<Category>& Channel::category() const
 {
   return m_category;
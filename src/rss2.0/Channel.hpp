@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the feed merger.
-    Copyright (C) 2015, 2017  Dirk Stolle
+    Copyright (C) 2015, 2017, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -92,6 +92,13 @@ namespace RSS20
       void addItem(const Item& item);
 
 
+      /** \brief add a new item to the channel without copying it
+       *
+       * \param item  the new item, must not be empty
+       */
+      void addItem(Item&& item);
+
+
       /** \brief sets the list of items in the feed
        *
        * \param all   vector of feed items
@@ -99,6 +106,21 @@ namespace RSS20
       void setItems(const std::vector<Item>& all);
 
 
+      /** \brief sets the list of items in the feed without copying it
+       *
+       * \param all   vector of feed items
+       */
+      void setItems(std::vector<Item>&& all);
+
+
+      /** \brief moves the items out of the channel
+       *
+       * \return Returns the items of the channel. The channel has no items
+       *         afterwards.
+       */
+      std::vector<Item> takeItems();
+
+
       /** \brief gets the channel's category element(s)
        *
        * \return Returns the category elements.
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the feed merger.
-    Copyright (C) 2015, 2022  Dirk Stolle
+    Copyright (C) 2015, 2022, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -48,7 +48,7 @@ const std::string& Cloud::domain() const
   return m_domain;
 }
 
-void Cloud::setDomain(const std::string& domain)
+void Cloud::setDomain(const std::string_view domain)
 {
   m_domain = domain;
 }
@@ -68,7 +68,7 @@ const std::string& Cloud::path() const
   return m_path;
 }
 
-void Cloud::setPath(const std::string& path)
+void Cloud::setPath(const std::string_view path)
 {
   m_path = path;
 }
@@ -78,7 +78,7 @@ const std::string& Cloud::registerProcedure() const
   return m_registerProcedure;
 }
 
-void Cloud::setRegisterProcedure(const std::string& registerProcedure)
+void Cloud::setRegisterProcedure(const std::string_view registerProcedure)
 {
   m_registerProcedure = registerProcedure;
 }
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the feed merger.
-    Copyright (C) 2015, 2022  Dirk Stolle
+    Copyright (C) 2015, 2022, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -23,6 +23,7 @@
 
 #include <cstdint>
 #include <string>
+#include <string_view>
 #include "Protocol.hpp"
 
 namespace RSS20
@@ -65,7 +66,7 @@ namespace RSS20
        *
        * \param domain  the new domain name
        */
-      void setDomain(const std::string& domain);
+      void setDomain(const std::string_view domain);
 
 
       /** \brief Returns the server's port for the connection.
@@ -94,7 +95,7 @@ namespace RSS20
        *
        * \param path  the new path on the server
        */
-      void setPath(const std::string& path);
+      void setPath(const std::string_view path);
 
 
       /** \brief Gets the procedure call.
@@ -108,7 +109,7 @@ namespace RSS20
        *
        * \param registerProcedure  the new procedure call to be registered
        */
-      void setRegisterProcedure(const std::string& registerProcedure);
+      void setRegisterProcedure(const std::string_view registerProcedure);
 
 
       /** \brief Returns the connection protocol.
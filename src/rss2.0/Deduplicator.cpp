@@ -0,0 +1,175 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the feed merger.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "Deduplicator.hpp"
+#include <sstream>
+#include "../Hash.hpp"
+
+namespace RSS20
+{
+
+Deduplicator::Deduplicator(const std::vector<Key>& keys, const Prefer prefer)
+: m_Keys(keys),
+  m_Prefer(prefer),
+  m_Slots(std::vector<Slot>(64)),
+  m_Used(0),
+  m_Duplicates(0)
+{
+}
+
+bool Deduplicator::keysFromString(const std::string& spec, std::vector<Key>& keys)
+{
+  keys.clear();
+  std::istringstream stream(spec);
+  std::string name;
+  while (std::getline(stream, name, ','))
+  {
+    Key key;
+    if (name == "guid")
+      key = Key::Guid;
+    else if (name == "link")
+      key = Key::Link;
+    else if (name == "title")
+      key = Key::TitleAndDate;
+    else
+      return false;
+    keys.push_back(key);
+  } //while
+  return !keys.empty();
+}
+
+bool Deduplicator::preferFromString(const std::string& name, Prefer& prefer)
+{
+  if (name == "newest")
+    prefer = Prefer::Newest;
+  else if (name == "first")
+    prefer = Prefer::FirstFeed;
+  else
+    return false;
+  return true;
+}
+
+const std::vector<Deduplicator::Key>& Deduplicator::keys() const
+{
+  return m_Keys;
+}
+
+Deduplicator::Prefer Deduplicator::prefer() const
+{
+  return m_Prefer;
+}
+
+std::string Deduplicator::fingerprint(const Item& item, const Key key)
+{
+  /* The first character tells the keys apart, so a link that happens to be
+     used as GUID by another item does not count as a match. */
+  switch (key)
+  {
+    case Key::Guid:
+         if (item.guid().get().empty())
+           return std::string();
+         return "g" + item.guid().get();
+    case Key::Link:
+         if (item.link().empty())
+           return std::string();
+         return "l" + item.link();
+    case Key::TitleAndDate:
+         if (item.title().empty())
+           return std::string();
+         return "t" + std::to_string(item.pubDate()) + "\n" + item.title();
+  } //switch
+  return std::string();
+}
+
+std::size_t Deduplicator::find(const std::uint64_t hash, const std::string& fingerprint) const
+{
+  const std::size_t mask = m_Slots.size() - 1;
+  std::size_t idx = static_cast<std::size_t>(hash) & mask;
+  //linear probing: the table is never full, so there is always an unused slot
+  while (!m_Slots[idx].fingerprint.empty())
+  {
+    if ((m_Slots[idx].hash == hash) && (m_Slots[idx].fingerprint == fingerprint))
+      return idx;
+    idx = (idx + 1) & mask;
+  } //while
+  return idx;
+}
+
+void Deduplicator::grow()
+{
+  std::vector<Slot> old(m_Slots.size() * 2);
+  old.swap(m_Slots);
+  for (auto& slot : old)
+  {
+    if (slot.fingerprint.empty())
+      continue;
+    const std::size_t idx = find(slot.hash, slot.fingerprint);
+    m_Slots[idx].hash = slot.hash;
+    m_Slots[idx].fingerprint = std::move(slot.fingerprint);
+  } //for
+}
+
+bool Deduplicator::insert(const Item& item)
+{
+  std::vector<std::pair<std::uint64_t, std::string> > prints;
+  prints.reserve(m_Keys.size());
+  for (const Key key : m_Keys)
+  {
+    std::string print = fingerprint(item, key);
+    if (print.empty())
+      continue;
+    const std::uint64_t hash = fnv1a(print);
+    if (!m_Slots[find(hash, print)].fingerprint.empty())
+    {
+      ++m_Duplicates;
+      return false;
+    }
+    prints.push_back(std::make_pair(hash, std::move(print)));
+  } //for
+
+  //New item: remember all of its fingerprints.
+  for (auto& print : prints)
+  {
+    //Keep the load factor at or below one half.
+    if (2 * (m_Used + 1) > m_Slots.size())
+      grow();
+    const std::size_t idx = find(print.first, print.second);
+    if (!m_Slots[idx].fingerprint.empty())
+      continue;
+    m_Slots[idx].hash = print.first;
+    m_Slots[idx].fingerprint = std::move(print.second);
+    ++m_Used;
+  } //for
+  return true;
+}
+
+std::size_t Deduplicator::duplicates() const
+{
+  return m_Duplicates;
+}
+
+void Deduplicator::clear()
+{
+  m_Slots = std::vector<Slot>(64);
+  m_Used = 0;
+  m_Duplicates = 0;
+}
+
+} //namespace
@@ -0,0 +1,169 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the feed merger.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef RSS20_DEDUPLICATOR_HPP
+#define RSS20_DEDUPLICATOR_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Item.hpp"
+
+namespace RSS20
+{
+  /** \brief detects items that occur more than once, e.g. in several feeds
+   *
+   * Each item is reduced to fingerprints (GUID, link, title plus date). The
+   * fingerprints of all items seen so far are kept in a hash index with open
+   * addressing, so every check takes constant time on average and a merge
+   * needs just a single pass over the items. The keys form a set: every key
+   * is checked, and an item is a duplicate as soon as any of them matches,
+   * so their order makes no difference. Which copy of an item is kept is
+   * decided by the order in which the items are checked; Merger checks them
+   * in the order that prefer() asks for.
+   */
+  class Deduplicator
+  {
+    public:
+      /** \brief item data that can identify an item */
+      enum class Key
+      {
+        Guid,         /**< the item's GUID */
+        Link,         /**< the item's link */
+        TitleAndDate  /**< the item's title together with its publication date */
+      };
+
+
+      /** \brief which copy of an item is kept */
+      enum class Prefer
+      {
+        Newest,   /**< the copy with the newest publication date */
+        FirstFeed /**< the copy from the first feed, in the order of the feeds */
+      };
+
+
+      /** \brief constructor
+       *
+       * \param keys    the keys that are checked, the order does not matter
+       * \param prefer  which copy of an item is kept
+       */
+      explicit Deduplicator(const std::vector<Key>& keys = { Key::Guid, Key::Link, Key::TitleAndDate },
+                            const Prefer prefer = Prefer::Newest);
+
+
+      /** \brief parses a comma-separated list of keys
+       *
+       * \param spec  the list, e.g. "guid,link,title"
+       * \param keys  variable that will be used to store the keys
+       * \return Returns true, if the list could be parsed.
+       *         Returns false, if the list is empty or contains unknown keys.
+       */
+      static bool keysFromString(const std::string& spec, std::vector<Key>& keys);
+
+
+      /** \brief gets the precedence of copies from its name
+       *
+       * \param name    the name: "newest" or "first"
+       * \param prefer  variable that will be used to store the precedence
+       * \return Returns true, if the name is valid.
+       *         Returns false otherwise.
+       */
+      static bool preferFromString(const std::string& name, Prefer& prefer);
+
+
+      /** \brief gets the keys that are checked
+       *
+       * \return Returns the keys in the order they were given.
+       */
+      const std::vector<Key>& keys() const;
+
+
+      /** \brief gets which copy of an item is kept
+       *
+       * \return Returns the precedence of copies.
+       */
+      Prefer prefer() const;
+
+
+      /** \brief checks whether an item is new and remembers it, if it is
+       *
+       * \param item  the item
+       * \return Returns true, if the item was not seen before.
+       *         Returns false, if any of its keys matches an item that was
+       *         seen before. The item is counted as duplicate then.
+       * \remarks Empty keys (e.g. an item without GUID) never match. The
+       *          first item that is checked wins, so items should be checked
+       *          in order of preference.
+       */
+      bool insert(const Item& item);
+
+
+      /** \brief gets the number of duplicates that were found so far
+       *
+       * \return Returns the number of items for which insert() returned false.
+       */
+      std::size_t duplicates() const;
+
+
+      /** \brief forgets all items that were seen so far */
+      void clear();
+    private:
+      /** slot of the hash index */
+      struct Slot
+      {
+        std::uint64_t hash;  /**< hash of the fingerprint */
+        std::string fingerprint; /**< fingerprint, empty for unused slots */
+      }; //struct
+
+
+      /** \brief gets the fingerprint of an item for a key
+       *
+       * \param item  the item
+       * \param key   the key
+       * \return Returns the fingerprint. Returns an empty string, if the item
+       *         has no data for that key.
+       */
+      static std::string fingerprint(const Item& item, const Key key);
+
+
+      /** \brief finds the slot of a fingerprint
+       *
+       * \param hash         hash of the fingerprint
+       * \param fingerprint  the fingerprint
+       * \return Returns the index of the slot that holds the fingerprint, or
+       *         the index of the unused slot where it would be inserted.
+       */
+      std::size_t find(const std::uint64_t hash, const std::string& fingerprint) const;
+
+
+      /** \brief doubles the size of the hash index */
+      void grow();
+
+
+      std::vector<Key> m_Keys; /**< keys that are checked */
+      Prefer m_Prefer; /**< which copy of an item is kept */
+      std::vector<Slot> m_Slots; /**< hash index, size is a power of two */
+      std::size_t m_Used; /**< number of used slots */
+      std::size_t m_Duplicates; /**< number of duplicates found so far */
+  }; //class
+
+} //namespace
+
+#endif // RSS20_DEDUPLICATOR_HPP
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the feed merger.
-    Copyright (C) 2015, 2022  Dirk Stolle
+    Copyright (C) 2015, 2022, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -35,7 +35,7 @@ const std::string& Enclosure::url() const
   return m_url;
 }
 
-void Enclosure::setUrl(const std::string& url)
+void Enclosure::setUrl(const std::string_view url)
 {
   m_url = url;
 }
@@ -55,7 +55,7 @@ const std::string& Enclosure::type() const
   return m_type;
 }
 
-void Enclosure::setType(const std::string& type)
+void Enclosure::setType(const std::string_view type)
 {
   m_type = type;
 }
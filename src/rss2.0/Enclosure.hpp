@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the feed merger.
-    Copyright (C) 2015, 2022  Dirk Stolle
+    Copyright (C) 2015, 2022, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -23,6 +23,7 @@
 
 #include <cstdint>
 #include <string>
+#include <string_view>
 
 namespace RSS20
 {
@@ -49,7 +50,7 @@ namespace RSS20
        *
        * \param url the new URL of the enclosure
        */
-      void setUrl(const std::string& url);
+      void setUrl(const std::string_view url);
 
 
       /** \brief Gets the enclosure's length in bytes.
@@ -77,7 +78,7 @@ namespace RSS20
        *
        * \param type the new MIME type of the enclosure
        */
-      void setType(const std::string& type);
+      void setType(const std::string_view type);
 
 
       /** \brief Checks whether this element is empty.
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the feed merger.
-    Copyright (C) 2015, 2017, 2022  Dirk Stolle
+    Copyright (C) 2015, 2017, 2022, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -19,10 +19,24 @@
 */
 
 #include "Merger.hpp"
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <utility>
 
 namespace RSS20
 {
 
+void Merger::describeMerge(Channel& result, const std::size_t feedCount)
+{
+  /* Title, link and description are required attributes. */
+  result.setTitle("Merged feed (composed from " + std::to_string(feedCount) + " individual feeds)");
+  //set placeholder for link
+  result.setLink("http:///dev/null");
+  //set placeholder for title
+  result.setDescription("This feed was created by merging items of several feeds into one feed.");
+}
+
 bool Merger::merge(const std::vector<Channel>& feeds, Channel& result)
 {
   //no feeds, no merge
@@ -40,12 +54,7 @@ bool Merger::merge(const std::vector<Channel>& feeds, Channel& result)
 
   //start with empty feed
   result = Channel();
-  /* Title, link and description are required attributes. */
-  result.setTitle("Merged feed (composed from " + std::to_string(feeds.size()) + " individual feeds)");
-  //set placeholder for link
-  result.setLink("http:///dev/null");
-  //set placeholder for title
-  result.setDescription("This feed was created by merging items of several feeds into one feed.");
+  describeMerge(result, feeds.size());
 
   for (const RSS20::Channel& channel : feeds)
   {
@@ -71,4 +80,215 @@ bool Merger::merge(const std::vector<Channel>& feeds, Channel& result)
   return true;
 }
 
+void Merger::sortNewestFirst(std::vector<Item>& items)
+{
+  const auto newer = [](const Item& a, const Item& b)
+  {
+    return a.pubDate() > b.pubDate();
+  };
+  //Most feeds list their items by date already.
+  if (!std::is_sorted(items.begin(), items.end(), newer))
+    std::stable_sort(items.begin(), items.end(), newer);
+}
+
+void Merger::keepNewest(std::vector<Item>& items, const std::size_t maxItems,
+                        const std::time_t since, std::vector<Item>* rest)
+{
+  if (since != BasicRSS::Channel::NoDate)
+  {
+    items.erase(std::remove_if(items.begin(), items.end(),
+                    [since](const Item& i) { return i.pubDate() < since; }),
+                items.end());
+  }
+  if ((maxItems == 0) || (items.size() <= maxItems))
+    return;
+
+  /* Find the date of the n-th newest item in linear time. All newer items
+     are kept, items with exactly that date are kept until there are enough. */
+  std::vector<std::time_t> dates;
+  dates.reserve(items.size());
+  for (const auto& item : items)
+  {
+    dates.push_back(item.pubDate());
+  } //for
+  std::nth_element(dates.begin(), dates.begin() + (maxItems - 1), dates.end(),
+                   std::greater<std::time_t>());
+  const std::time_t limit = dates[maxItems - 1];
+  std::size_t newer = 0;
+  for (std::size_t idx = 0; idx < maxItems - 1; ++idx)
+  {
+    if (dates[idx] > limit)
+      ++newer;
+  } //for
+  std::size_t equalLeft = maxItems - newer;
+  std::vector<Item> kept;
+  kept.reserve(maxItems);
+  for (auto& item : items)
+  {
+    bool keep = (item.pubDate() > limit);
+    if (!keep && (item.pubDate() == limit) && (equalLeft > 0))
+    {
+      --equalLeft;
+      keep = true;
+    }
+    if (keep)
+      kept.push_back(std::move(item));
+    else if (rest != nullptr)
+      rest->push_back(std::move(item));
+  } //for
+  items = std::move(kept);
+}
+
+void Merger::removeDuplicates(std::vector<Item>& items, Deduplicator& deduplicator)
+{
+  items.erase(std::remove_if(items.begin(), items.end(),
+                  [&deduplicator](const Item& i) { return !deduplicator.insert(i); }),
+              items.end());
+}
+
+bool Merger::mergeSorted(std::vector<Channel>&& feeds, Channel& result,
+                         const std::size_t maxItems, const std::time_t since,
+                         Deduplicator* deduplicator)
+{
+  /* If the first feed's copy wins, duplicates are removed in the order of the
+     feeds before anything else. Otherwise the newest copy wins, and that is
+     the first copy the sorted merge sees. */
+  const bool firstFeedWins = (deduplicator != nullptr)
+      && (deduplicator->prefer() == Deduplicator::Prefer::FirstFeed);
+  /* Duplicates that are removed during the merge leave gaps, so the items
+     beyond the newest maxItems of a feed are kept aside in that case. They
+     are only sorted, if a feed runs out of items before the limit is met. */
+  const bool keepRest = (deduplicator != nullptr) && !firstFeedWins && (maxItems > 0);
+
+  //no feeds, no merge
+  if (feeds.empty())
+  {
+    result = RSS20::Channel();
+    return false;
+  }
+  //Only one feed? Trivial "merge", but the items still need to be sorted.
+  if (feeds.size() == 1)
+  {
+    result = std::move(feeds[0]);
+    std::vector<Item> items = result.takeItems();
+    if (firstFeedWins)
+    {
+      keepNewest(items, 0, since);
+      removeDuplicates(items, *deduplicator);
+    }
+    std::vector<Item> rest;
+    keepNewest(items, maxItems, since, keepRest ? &rest : nullptr);
+    sortNewestFirst(items);
+    if ((deduplicator != nullptr) && !firstFeedWins)
+    {
+      removeDuplicates(items, *deduplicator);
+      //Fill the gaps with the next newest items.
+      while (!rest.empty() && (items.size() < maxItems))
+      {
+        std::vector<Item> chunk = std::move(rest);
+        rest.clear();
+        keepNewest(chunk, maxItems - items.size(), BasicRSS::Channel::NoDate, &rest);
+        sortNewestFirst(chunk);
+        removeDuplicates(chunk, *deduplicator);
+        std::move(chunk.begin(), chunk.end(), std::back_inserter(items));
+      } //while
+    }
+    result.setItems(std::move(items));
+    return true;
+  }
+
+  //start with empty feed
+  result = Channel();
+  describeMerge(result, feeds.size());
+
+  //Get the sorted items of each feed.
+  std::vector<std::vector<Item> > runs;
+  runs.reserve(feeds.size());
+  //items of each run that are older than its sorted items, not sorted yet
+  std::vector<std::vector<Item> > rests;
+  rests.reserve(feeds.size());
+  std::size_t total = 0;
+  for (RSS20::Channel& channel : feeds)
+  {
+    std::vector<Item> items = channel.takeItems();
+    if (items.empty())
+    {
+      //use data from channel instead of items (of which there are none)
+      Item channelItem(channel.title(), channel.link(), channel.description(),
+                       channel.managingEditor(), //"author"
+                       channel.category(), "" /*comments*/, Enclosure(),
+                       GUID(), channel.pubDate(), Source());
+      if (!channelItem.empty())
+        items.push_back(std::move(channelItem));
+    } //if channel has no items
+    //Copies that lose against an earlier feed must not take up the limit.
+    if (firstFeedWins)
+    {
+      keepNewest(items, 0, since);
+      removeDuplicates(items, *deduplicator);
+    }
+    //Only the newest items of each feed can make it into the result.
+    std::vector<Item> rest;
+    keepNewest(items, maxItems, since, keepRest ? &rest : nullptr);
+    if (items.empty())
+      continue;
+    sortNewestFirst(items);
+    total += items.size() + rest.size();
+    runs.push_back(std::move(items));
+    rests.push_back(std::move(rest));
+  } //for all feeds
+  if ((maxItems > 0) && (total > maxItems))
+    total = maxItems;
+
+  /* Heap of the next item of each feed: newest date on top, and the first
+     feed wins, if dates are equal. The dates are stored in the heap, so the
+     comparison does not need to access the items. */
+  typedef std::pair<std::time_t, std::size_t> HeapEntry;
+  const auto lessRecent = [](const HeapEntry& a, const HeapEntry& b)
+  {
+    if (a.first != b.first)
+      return a.first < b.first;
+    return a.second > b.second;
+  };
+  std::vector<HeapEntry> heap;
+  heap.reserve(runs.size());
+  for (std::size_t r = 0; r < runs.size(); ++r)
+  {
+    heap.push_back(HeapEntry(runs[r].front().pubDate(), r));
+  } //for
+  std::make_heap(heap.begin(), heap.end(), lessRecent);
+
+  std::vector<std::size_t> positions(runs.size(), 0);
+  std::vector<Item> merged;
+  merged.reserve(total);
+  while (!heap.empty() && (merged.size() < total))
+  {
+    std::pop_heap(heap.begin(), heap.end(), lessRecent);
+    const std::size_t r = heap.back().second;
+    heap.pop_back();
+    //The first copy of an item wins, that is the newest copy.
+    if ((deduplicator == nullptr) || firstFeedWins
+        || deduplicator->insert(runs[r][positions[r]]))
+      merged.push_back(std::move(runs[r][positions[r]]));
+    ++positions[r];
+    //Removed duplicates left the run short, so sort the next newest items.
+    if ((positions[r] == runs[r].size()) && !rests[r].empty() && (merged.size() < total))
+    {
+      runs[r] = std::move(rests[r]);
+      rests[r].clear();
+      keepNewest(runs[r], total - merged.size(), BasicRSS::Channel::NoDate, &rests[r]);
+      sortNewestFirst(runs[r]);
+      positions[r] = 0;
+    }
+    if (positions[r] < runs[r].size())
+    {
+      heap.push_back(HeapEntry(runs[r][positions[r]].pubDate(), r));
+      std::push_heap(heap.begin(), heap.end(), lessRecent);
+    }
+  } //while
+
+  result.setItems(std::move(merged));
+  return true;
+}
+
 } //namespace
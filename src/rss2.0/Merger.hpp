@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the feed merger.
-    Copyright (C) 2017  Dirk Stolle
+    Copyright (C) 2017, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -22,6 +22,7 @@
 #define RSS20_MERGER_HPP
 
 #include "Channel.hpp"
+#include "Deduplicator.hpp"
 
 namespace RSS20
 {
@@ -30,6 +31,14 @@ namespace RSS20
   class Merger
   {
     public:
+      /** \brief sets title, link and description of a merged feed
+       *
+       * \param result     the merged feed
+       * \param feedCount  number of feeds that were merged
+       */
+      static void describeMerge(Channel& result, const std::size_t feedCount);
+
+
       /** \brief merges multiple RSS 2.0 feeds into one feed
        *
        * \param feeds  list of feeds that shall be merged
@@ -38,6 +47,68 @@ namespace RSS20
        *         Returns false otherwise.
        */
       static bool merge(const std::vector<Channel>& feeds, Channel& result);
+
+
+      /** \brief merges multiple RSS 2.0 feeds into one feed with sorted items
+       *
+       * \param feeds  list of feeds that shall be merged, their items are
+       *               moved into the result
+       * \param result resulting feed containing all merged data, with the
+       *               items sorted by publication date, newest item first
+       * \param maxItems  maximum number of items in the result, zero means
+       *                  no limit
+       * \param since     items published before that date are left out,
+       *                  NoDate means no limit
+       * \param deduplicator  if not nullptr, only one copy of items that occur
+       *                      more than once is kept: the newest copy or the
+       *                      copy of the first feed, see Deduplicator::prefer()
+       * \return Returns true, if the merge was successful.
+       *         Returns false otherwise.
+       * \remarks The result is the same as the result of merge() with sorted
+       *          items, but the items are not copied. Each feed's items are
+       *          sorted on their own (if they are not sorted already) and are
+       *          then merged in one pass. Items with the same date keep the
+       *          order of their feeds.
+       *          With a limit, only the newest maxItems items of every feed
+       *          are sorted, so the work depends on maxItems and not on the
+       *          total number of items. If removed duplicates leave a feed
+       *          short of items, its next newest items are sorted on demand.
+       */
+      static bool mergeSorted(std::vector<Channel>&& feeds, Channel& result,
+                              const std::size_t maxItems = 0,
+                              const std::time_t since = BasicRSS::Channel::NoDate,
+                              Deduplicator* deduplicator = nullptr);
+  private:
+      /** \brief sorts items by publication date, newest item first
+       *
+       * \param items  the items to sort
+       * \remarks Items that are already in that order are left as they are.
+       *          Items with the same date keep their order.
+       */
+      static void sortNewestFirst(std::vector<Item>& items);
+
+
+      /** \brief removes all items but the newest ones
+       *
+       * \param items     the items, in any order
+       * \param maxItems  maximum number of items to keep, zero means no limit
+       * \param since     items published before that date are removed,
+       *                  NoDate means no limit
+       * \param rest      if not nullptr, items beyond maxItems are appended
+       *                  to it instead of being removed
+       * \remarks The remaining items and the items in rest keep their order.
+       *          If several items have the same date, the first ones are kept.
+       */
+      static void keepNewest(std::vector<Item>& items, const std::size_t maxItems,
+                             const std::time_t since, std::vector<Item>* rest = nullptr);
+
+
+      /** \brief removes items that the deduplicator has seen before
+       *
+       * \param items         the items, the first copy of an item is kept
+       * \param deduplicator  the deduplicator
+       */
+      static void removeDuplicates(std::vector<Item>& items, Deduplicator& deduplicator);
   }; //class
 
 } //namespace
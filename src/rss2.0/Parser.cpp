@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the feed merger.
-    Copyright (C) 2015, 2017, 2022  Dirk Stolle
+    Copyright (C) 2015, 2017, 2022, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -20,6 +20,7 @@
 
 #include "Parser.hpp"
 #include <iostream>
+#include <string_view>
 #include "../rfc822/Date.hpp"
 #include "../StringFunctions.hpp"
 #include "../xml/XMLDocument.hpp"
@@ -29,7 +30,7 @@ namespace RSS20
 
 bool Parser::itemFromNode(const XMLNode& itemNode, Item& theItem)
 {
-  if (!itemNode.isElementNode() || (itemNode.getNameAsString() != "item"))
+  if (!itemNode.isElementNode() || (itemNode.getElementName() != ElementName::Item))
     return false;
 
   theItem = Item("", "", "", "", std::set<Category>(), "", Enclosure(), GUID(),
@@ -40,9 +41,12 @@ bool Parser::itemFromNode(const XMLNode& itemNode, Item& theItem)
 
   XMLNode child = itemNode.getChild();
 
-  while (child.hasNextSibling())
+  while (true)
   {
     child.skipEmptyCommentAndTextSiblings();
+    //Only comments or whitespace may follow the last element.
+    if (child.isCommentNode() || child.isBlankTextNode())
+      break;
 
     if (!child.isElementNode())
     {
@@ -51,9 +55,14 @@ bool Parser::itemFromNode(const XMLNode& itemNode, Item& theItem)
       return false;
     }
 
-    const std::string nodeName = child.getNameAsString();
+    const ElementName name = child.getElementName();
 
-    if (nodeName == "title")
+    if (child.getNamespaceURI() != itemNode.getNamespaceURI())
+    {
+      //Elements of other namespaces (e.g. <dc:creator>) are extensions,
+      //which are allowed by the RSS 2.0 specification and get skipped.
+    }
+    else if (name == ElementName::Title)
     {
       if (!theItem.title().empty())
       {
@@ -62,7 +71,7 @@ bool Parser::itemFromNode(const XMLNode& itemNode, Item& theItem)
       } //if title was already specified
       theItem.setTitle(child.getContentBoth());
     }
-    else if (nodeName == "link")
+    else if (name == ElementName::Link)
     {
       if (!theItem.link().empty())
       {
@@ -71,7 +80,7 @@ bool Parser::itemFromNode(const XMLNode& itemNode, Item& theItem)
       } //if link was already specified
       theItem.setLink(child.getContentBoth());
     }
-    else if (nodeName == "description")
+    else if (name == ElementName::Description)
     {
       if (!theItem.description().empty())
       {
@@ -80,7 +89,7 @@ bool Parser::itemFromNode(const XMLNode& itemNode, Item& theItem)
       } //if description was already specified
       theItem.setDescription(child.getContentBoth());
     }
-    else if (nodeName == "author")
+    else if (name == ElementName::Author)
     {
       if (!theItem.author().empty())
       {
@@ -89,7 +98,7 @@ bool Parser::itemFromNode(const XMLNode& itemNode, Item& theItem)
       } //if author was already specified
       theItem.setAuthor(child.getContentBoth());
     }
-    else if (nodeName == "category")
+    else if (name == ElementName::Category)
     {
       Category cat;
       if (!categoryFromNode(child, cat))
@@ -104,7 +113,7 @@ bool Parser::itemFromNode(const XMLNode& itemNode, Item& theItem)
       } //if category was already specified
       theItem.addCategory(std::move(cat));
     }
-    else if (nodeName == "comments")
+    else if (name == ElementName::Comments)
     {
       if (!theItem.comments().empty())
       {
@@ -113,7 +122,7 @@ bool Parser::itemFromNode(const XMLNode& itemNode, Item& theItem)
       } //if comments was already specified
       theItem.setComments(child.getContentBoth());
     }
-    else if (nodeName == "enclosure")
+    else if (name == ElementName::Enclosure)
     {
       if (!theItem.enclosure().empty())
       {
@@ -128,7 +137,7 @@ bool Parser::itemFromNode(const XMLNode& itemNode, Item& theItem)
       }
       theItem.setEnclosure(std::move(encl));
     } //if enclosure
-    else if (nodeName == "guid")
+    else if (name == ElementName::Guid)
     {
       if (!theItem.guid().empty())
       {
@@ -163,7 +172,7 @@ bool Parser::itemFromNode(const XMLNode& itemNode, Item& theItem)
       // set GUID
       theItem.setGUID(GUID(plainGUID, permaLink));
     } // if GUID
-    else if (nodeName == "pubDate")
+    else if (name == ElementName::PubDate)
     {
       if (theItem.pubDate() != BasicRSS::Channel::NoDate)
       {
@@ -179,7 +188,7 @@ bool Parser::itemFromNode(const XMLNode& itemNode, Item& theItem)
       }
       theItem.setPubDate(thePubDate);
     }
-    else if (nodeName == "source")
+    else if (name == ElementName::Source)
     {
       if (!theItem.source().empty())
       {
@@ -196,10 +205,12 @@ bool Parser::itemFromNode(const XMLNode& itemNode, Item& theItem)
     }
     else
     {
-      std::cerr << "Found unexpected node name within item: \"" << nodeName
+      std::cerr << "Found unexpected node name within item: \"" << child.getNameAsString()
                 << "\"!" << std::endl;
       return false;
     }
+    if (!child.hasNextSibling())
+      break;
     child = child.getNextSibling();
   } //while
   //We are done here. Item should not be empty by now.
@@ -208,10 +219,10 @@ bool Parser::itemFromNode(const XMLNode& itemNode, Item& theItem)
 
 bool Parser::cloudFromNode(const XMLNode& cloudNode, Cloud& cloudInfo)
 {
-  if (!cloudNode.isElementNode() || (cloudNode.getNameAsString() != "cloud"))
+  if (!cloudNode.isElementNode() || (cloudNode.getElementName() != ElementName::Cloud))
     return false;
 
-  const auto attributes = cloudNode.getAttributes();
+  const auto attributes = cloudNode.getAttributeViews();
   if (attributes.size() != 5)
   {
     std::cerr << "Cloud element should have exactly five attributes, but "
@@ -222,9 +233,9 @@ bool Parser::cloudFromNode(const XMLNode& cloudNode, Cloud& cloudInfo)
 
   //initialize element with empty values
   cloudInfo = Cloud();
-  for (const auto& a : attributes)
+  for (const auto a : attributes)
   {
-    const std::string attrName = a.first;
+    const std::string_view attrName = a.name;
     if (attrName == "domain")
     {
       if (!cloudInfo.domain().empty())
@@ -232,7 +243,7 @@ bool Parser::cloudFromNode(const XMLNode& cloudNode, Cloud& cloudInfo)
         std::cerr << "Cloud element already has a domain!" << std::endl;
         return false;
       } //if domain was already specified
-      cloudInfo.setDomain(a.second);
+      cloudInfo.setDomain(a.value);
     } //if domain
     else if (attrName == "port")
     {
@@ -242,9 +253,9 @@ bool Parser::cloudFromNode(const XMLNode& cloudNode, Cloud& cloudInfo)
         return false;
       } //if port was already specified
       int port = -1;
-      if (!stringToInt(a.second, port))
+      if (!stringToInt(std::string(a.value), port))
       {
-        std::cerr << "Error while parsing <cloud>'s port: " << a.second
+        std::cerr << "Error while parsing <cloud>'s port: " << a.value
                   << " is not an integer value!" << std::endl;
         return false;
       }
@@ -263,7 +274,7 @@ bool Parser::cloudFromNode(const XMLNode& cloudNode, Cloud& cloudInfo)
         std::cerr << "Cloud element already has a path!" << std::endl;
         return false;
       } //if path was already specified
-      cloudInfo.setPath(a.second);
+      cloudInfo.setPath(a.value);
     } //if path
     else if (attrName == "registerProcedure")
     {
@@ -272,7 +283,7 @@ bool Parser::cloudFromNode(const XMLNode& cloudNode, Cloud& cloudInfo)
         std::cerr << "Cloud element already has a registerProcedure!" << std::endl;
         return false;
       } //if registerProcedure was already specified
-      cloudInfo.setRegisterProcedure(a.second);
+      cloudInfo.setRegisterProcedure(a.value);
     } //if registerProcedure
     else if (attrName == "protocol")
     {
@@ -281,10 +292,10 @@ bool Parser::cloudFromNode(const XMLNode& cloudNode, Cloud& cloudInfo)
         std::cerr << "Cloud element already has a protocol!" << std::endl;
         return false;
       } //if protocol was already specified
-      const auto proto = from_string(a.second);
+      const auto proto = from_string(std::string(a.value));
       if (proto == Protocol::none)
       {
-        std::cerr << "Error: '" << a.second << "' is not an accepted protocol "
+        std::cerr << "Error: '" << a.value << "' is not an accepted protocol "
                   << "value! Accepted values are 'soap', 'xml-rpc' and "
                   << "'http-post'." << std::endl;
       }
@@ -292,7 +303,7 @@ bool Parser::cloudFromNode(const XMLNode& cloudNode, Cloud& cloudInfo)
     } //if protocol
     else
     {
-      std::cerr << "Error: found unknown attribute " << a.first
+      std::cerr << "Error: found unknown attribute " << a.name
                 << " in <cloud> element of RSS 2.0 channel!" << std::endl;
       return false;
     }
@@ -313,10 +324,10 @@ bool Parser::cloudFromNode(const XMLNode& cloudNode, Cloud& cloudInfo)
 bool Parser::enclosureFromNode(const XMLNode& enclosureNode, Enclosure& enclosureInfo)
 {
   if (!enclosureNode.isElementNode()
-      || (enclosureNode.getNameAsString() != "enclosure"))
+      || (enclosureNode.getElementName() != ElementName::Enclosure))
     return false;
 
-  const auto attributes = enclosureNode.getAttributes();
+  const auto attributes = enclosureNode.getAttributeViews();
   if (attributes.size() != 3)
   {
     std::cerr << "Enclosure element should have exactly three attributes, but "
@@ -327,9 +338,9 @@ bool Parser::enclosureFromNode(const XMLNode& enclosureNode, Enclosure& enclosur
 
   //initialize element with empty values
   enclosureInfo = Enclosure();
-  for (const auto& a : attributes)
+  for (const auto a : attributes)
   {
-    const std::string attrName = a.first;
+    const std::string_view attrName = a.name;
     if (attrName == "url")
     {
       if (!enclosureInfo.url().empty())
@@ -337,7 +348,7 @@ bool Parser::enclosureFromNode(const XMLNode& enclosureNode, Enclosure& enclosur
         std::cerr << "Enclosure element already has URL!" << std::endl;
         return false;
       } //if URL was already specified
-      enclosureInfo.setUrl(a.second);
+      enclosureInfo.setUrl(a.value);
     } //if URL
     else if (attrName == "length")
     {
@@ -347,9 +358,9 @@ bool Parser::enclosureFromNode(const XMLNode& enclosureNode, Enclosure& enclosur
         return false;
       } //if length was already specified
       unsigned int length = -1;
-      if (!stringToUnsignedInt(a.second, length))
+      if (!stringToUnsignedInt(std::string(a.value), length))
       {
-        std::cerr << "Error while parsing <enclosure>'s length: " << a.second
+        std::cerr << "Error while parsing <enclosure>'s length: " << a.value
                   << " is not an integer value!" << std::endl;
         return false;
       }
@@ -367,11 +378,11 @@ bool Parser::enclosureFromNode(const XMLNode& enclosureNode, Enclosure& enclosur
         std::cerr << "Enclosure element already has a type!" << std::endl;
         return false;
       } //if type was already specified
-      enclosureInfo.setType(a.second);
+      enclosureInfo.setType(a.value);
     } //if path
     else
     {
-      std::cerr << "Error: found unknown attribute " << a.first
+      std::cerr << "Error: found unknown attribute " << a.name
                 << " in <enclosure> element of RSS 2.0 channel!" << std::endl;
       return false;
     }
@@ -390,21 +401,23 @@ bool Parser::enclosureFromNode(const XMLNode& enclosureNode, Enclosure& enclosur
 
 bool Parser::sourceFromNode(const XMLNode& sourceNode, Source& sourceInfo)
 {
-  if (!sourceNode.isElementNode() || (sourceNode.getNameAsString() != "source"))
+  if (!sourceNode.isElementNode() || (sourceNode.getElementName() != ElementName::Source))
     return false;
 
-  const auto attrs = sourceNode.getAttributes();
+  const auto attrs = sourceNode.getAttributeViews();
   if (attrs.size() != 1)
   {
     std::cerr << "Error: Node <source> should have exactly one attribute!" << std::endl;
     return false;
   } //if
-  if (attrs[0].first != "url")
+  const XMLNode::AttributeView url = *attrs.begin();
+  if (url.name != "url")
   {
     std::cerr << "Error: Node <source> should have a 'url' attribute!" << std::endl;
     return false;
   }
-  sourceInfo = Source(sourceNode.getContentBoth(), attrs[0].second);
+  std::string buffer;
+  sourceInfo = Source(sourceNode.getContentView(buffer), url.value);
   if (sourceInfo.empty())
   {
     std::cerr << "Error: <source> node is (partially) empty." << std::endl;
@@ -415,24 +428,26 @@ bool Parser::sourceFromNode(const XMLNode& sourceNode, Source& sourceInfo)
 
 bool Parser::categoryFromNode(const XMLNode& categoryNode, Category& categoryInfo)
 {
-  if (!categoryNode.isElementNode() || (categoryNode.getNameAsString() != "category"))
+  if (!categoryNode.isElementNode() || (categoryNode.getElementName() != ElementName::Category))
     return false;
 
-  const auto attrs = categoryNode.getAttributes();
+  const auto attrs = categoryNode.getAttributeViews();
   if (attrs.size() > 1)
   {
     std::cerr << "Error: Node <category> should have not more than one attribute!" << std::endl;
     return false;
   } //if
-  categoryInfo = Category(categoryNode.getContentBoth(), "");
+  std::string buffer;
+  categoryInfo = Category(categoryNode.getContentView(buffer), "");
   if (!attrs.empty())
   {
-    if (attrs[0].first != "domain")
+    const XMLNode::AttributeView domain = *attrs.begin();
+    if (domain.name != "domain")
     {
       std::cerr << "Error: Node <category>'s attribute must be domain!" << std::endl;
       return false;
     } //if (inner)
-    categoryInfo.setDomain(attrs[0].second);
+    categoryInfo.setDomain(domain.value);
   } //if
   return !categoryInfo.empty();
 }
@@ -448,11 +463,19 @@ bool Parser::fromString(const std::string& source, Channel& feed)
 {
   if (source.empty())
     return false;
-  XMLDocument doc(xmlParseDoc(reinterpret_cast<const xmlChar*>(source.c_str())));
+  return fromBuffer(source.data(), source.size(), feed);
+}
+
+bool Parser::fromBuffer(const char* data, const std::size_t size, Channel& feed,
+                        const char* encoding, const int options)
+{
+  if ((data == nullptr) || (size == 0))
+    return false;
+  const XMLDocument doc(data, size, encoding, options);
   return fromDocument(doc, feed);
 }
 
-bool Parser::fromDocument(const XMLDocument& doc, Channel& feed)
+bool Parser::fromDocument(const XMLDocumentView doc, Channel& feed)
 {
   if (!doc.isParsed())
   {
@@ -466,7 +489,7 @@ bool Parser::fromDocument(const XMLDocument& doc, Channel& feed)
     return false;
   }
   XMLNode node = doc.getRootNode();
-  if (node.getNameAsString()!="rss")
+  if (node.getElementName() != ElementName::Rss)
   {
     std::cerr << "Root element's name is not \"rss\" but \""
               << node.getNameAsString() << "\" instead." << std::endl;
@@ -496,7 +519,7 @@ bool Parser::fromDocument(const XMLDocument& doc, Channel& feed)
   //skip empty comment and text nodes
   node.skipEmptyCommentAndTextSiblings();
 
-  if (!node.isElementNode() || (node.getNameAsString() != "channel"))
+  if (!node.isElementNode() || (node.getElementName() != ElementName::Channel))
   {
     std::cerr << "Child node of <rss> node must be <channel> node! "
               << "However, node's name is " << node.getNameAsString() << "."
@@ -511,6 +534,7 @@ bool Parser::fromDocument(const XMLDocument& doc, Channel& feed)
     std::cerr << "Node <channel> has no child elements!";
     return false;
   }
+  const std::string_view channelNamespace = node.getNamespaceURI();
   node = node.getChild();
 
   //initialize empty channel / feed
@@ -522,11 +546,23 @@ bool Parser::fromDocument(const XMLDocument& doc, Channel& feed)
     node.skipEmptyCommentAndTextSiblings();
     if (!node.isElementNode())
     {
-      //No more element node means we can break out of the loop
-      break;
+      //No more sibling means we can break out of the loop.
+      if (!node.hasNextSibling())
+        break;
+      node = node.getNextSibling();
+      continue;
     } //if
 
-    const std::string nodeName = node.getNameAsString();
+    //Elements of other namespaces (e.g. <atom:link>) are extensions.
+    if (node.getNamespaceURI() != channelNamespace)
+    {
+      if (!node.hasNextSibling())
+        break;
+      node = node.getNextSibling();
+      continue;
+    }
+
+    const ElementName name = node.getElementName();
     bool errors = false;
     if (commonChannelElementFromNode(node, feed, errors))
     {
@@ -536,7 +572,7 @@ bool Parser::fromDocument(const XMLDocument& doc, Channel& feed)
         return false;
       } //if
     } //if common channel element was parsed
-    else if (nodeName == "item")
+    else if (name == ElementName::Item)
     {
       Item it = Item("", "", "", "", std::set<Category>(), "", Enclosure(), GUID(),
                      0, Source());
@@ -547,7 +583,7 @@ bool Parser::fromDocument(const XMLDocument& doc, Channel& feed)
       }
       feed.addItem(it);
     } //if item
-    else if (nodeName == "category")
+    else if (name == ElementName::Category)
     {
       Category cat;
       if (!categoryFromNode(node, cat))
@@ -562,7 +598,7 @@ bool Parser::fromDocument(const XMLDocument& doc, Channel& feed)
       } //if category was already specified
       feed.addCategory(std::move(cat));
     } //if
-    else if (nodeName == "generator")
+    else if (name == ElementName::Generator)
     {
       if (!feed.generator().empty())
       {
@@ -571,7 +607,7 @@ bool Parser::fromDocument(const XMLDocument& doc, Channel& feed)
       } //if generator was already specified
       feed.setGenerator(node.getContentBoth());
     } //if
-    else if (nodeName == "cloud")
+    else if (name == ElementName::Cloud)
     {
       if (!feed.cloud().empty())
       {
@@ -586,7 +622,7 @@ bool Parser::fromDocument(const XMLDocument& doc, Channel& feed)
       }
       feed.setCloud(std::move(cl));
     } //if cloud
-    else if (nodeName == "ttl")
+    else if (name == ElementName::Ttl)
     {
       if (feed.ttl() >= 0)
       {
@@ -609,7 +645,7 @@ bool Parser::fromDocument(const XMLDocument& doc, Channel& feed)
       }
       feed.setTtl(ttl);
     } //if ttl
-    else if (nodeName == "textInput")
+    else if (name == ElementName::TextInput)
     {
       if (!feed.textInput().empty())
       {
@@ -626,7 +662,7 @@ bool Parser::fromDocument(const XMLDocument& doc, Channel& feed)
     } //if textInput
     else
     {
-      std::cerr << "Found unexpected node name in channel: \"" << nodeName << "\"!"
+      std::cerr << "Found unexpected node name in channel: \"" << node.getNameAsString() << "\"!"
                 << std::endl;
       return false;
     }
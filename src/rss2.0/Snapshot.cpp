@@ -0,0 +1,410 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the feed merger.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "Snapshot.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <optional>
+#include <set>
+#include <vector>
+#include "../AtomicFile.hpp"
+#include "../MappedFile.hpp"
+
+namespace RSS20
+{
+
+//signature at the start of each snapshot, includes the format version
+const char cSnapshotSignature[8] = { 'F', 'M', 'S', 'N', 'A', 'P', '0', '1' };
+
+/* Appends an unsigned integer with the given number of bytes. */
+static void putNumber(std::string& data, std::uint64_t value, const unsigned int bytes)
+{
+  for (unsigned int i = 0; i < bytes; ++i)
+  {
+    data.push_back(static_cast<char>(value & 0xFF));
+    value >>= 8;
+  }
+}
+
+/* Appends a string with its length in front of it. */
+static bool putString(std::string& data, const std::string& text)
+{
+  if (text.size() > std::numeric_limits<std::uint32_t>::max())
+    return false;
+  putNumber(data, text.size(), 4);
+  data.append(text);
+  return true;
+}
+
+static void putDate(std::string& data, const std::time_t date)
+{
+  putNumber(data, static_cast<std::uint64_t>(static_cast<std::int64_t>(date)), 8);
+}
+
+/* Appends the indices of categories in the category table. */
+static void putCategories(std::string& data, const std::set<Category>& categories,
+                          const std::map<Category, std::uint32_t>& table)
+{
+  putNumber(data, categories.size(), 4);
+  for (const auto& category : categories)
+  {
+    putNumber(data, table.at(category), 4);
+  }
+}
+
+/* Appends width or height of an image, 2^32 - 1 means that it is not set. */
+static void putDimension(std::string& data, const std::optional<unsigned int>& dimension)
+{
+  putNumber(data, dimension.has_value() ? dimension.value() : 0xFFFFFFFFu, 4);
+}
+
+namespace
+{
+
+/* Reads the parts of a snapshot and checks that they are within bounds. */
+class SnapshotReader
+{
+  public:
+    SnapshotReader(const char* data, const std::size_t size)
+    : m_Pos(reinterpret_cast<const unsigned char*>(data)),
+      m_End(reinterpret_cast<const unsigned char*>(data) + size)
+    {
+    }
+
+    bool atEnd() const
+    {
+      return m_Pos == m_End;
+    }
+
+    bool getNumber(std::uint64_t& value, const unsigned int bytes)
+    {
+      if (static_cast<std::size_t>(m_End - m_Pos) < bytes)
+        return false;
+      value = 0;
+      for (unsigned int i = 0; i < bytes; ++i)
+      {
+        value |= static_cast<std::uint64_t>(m_Pos[i]) << (8 * i);
+      }
+      m_Pos += bytes;
+      return true;
+    }
+
+    bool getCount(std::uint32_t& count)
+    {
+      std::uint64_t value = 0;
+      if (!getNumber(value, 4))
+        return false;
+      count = static_cast<std::uint32_t>(value);
+      return true;
+    }
+
+    bool getString(std::string& text)
+    {
+      std::uint32_t length = 0;
+      if (!getCount(length) || (static_cast<std::size_t>(m_End - m_Pos) < length))
+        return false;
+      text.assign(reinterpret_cast<const char*>(m_Pos), length);
+      m_Pos += length;
+      return true;
+    }
+
+    bool getDate(std::time_t& date)
+    {
+      std::uint64_t value = 0;
+      if (!getNumber(value, 8))
+        return false;
+      date = static_cast<std::time_t>(static_cast<std::int64_t>(value));
+      return true;
+    }
+
+    bool getCategories(std::set<Category>& categories, const std::vector<Category>& table)
+    {
+      std::uint32_t count = 0;
+      if (!getCount(count))
+        return false;
+      categories.clear();
+      for (std::uint32_t i = 0; i < count; ++i)
+      {
+        std::uint32_t index = 0;
+        if (!getCount(index) || (index >= table.size()))
+          return false;
+        categories.insert(categories.end(), table[index]);
+      } //for
+      return true;
+    }
+
+    bool getDimension(std::optional<unsigned int>& dimension)
+    {
+      std::uint32_t value = 0;
+      if (!getCount(value))
+        return false;
+      dimension = (value == 0xFFFFFFFFu) ? std::optional<unsigned int>()
+                                         : std::optional<unsigned int>(value);
+      return true;
+    }
+  private:
+    const unsigned char* m_Pos; /**< current read position */
+    const unsigned char* m_End; /**< end of the data */
+}; //class
+
+} //namespace
+
+bool Snapshot::toString(const Channel& feed, std::string& data)
+{
+  //Items of a feed often share their categories, so they are stored once.
+  std::map<Category, std::uint32_t> table;
+  std::vector<const Category*> categories;
+  const auto addCategories = [&table, &categories](const std::set<Category>& set)
+  {
+    for (const auto& category : set)
+    {
+      if (table.emplace(category, categories.size()).second)
+        categories.push_back(&category);
+    }
+  };
+  addCategories(feed.category());
+  for (const auto& item : feed.items())
+  {
+    addCategories(item.category());
+  }
+
+  std::string result(cSnapshotSignature, sizeof(cSnapshotSignature));
+  bool fits = (categories.size() <= std::numeric_limits<std::uint32_t>::max())
+      && (feed.items().size() <= std::numeric_limits<std::uint32_t>::max());
+  putNumber(result, categories.size(), 4);
+  for (const Category* category : categories)
+  {
+    fits = putString(result, category->get()) && putString(result, category->domain()) && fits;
+  }
+
+  fits = putString(result, feed.title()) && putString(result, feed.link())
+      && putString(result, feed.description()) && putString(result, feed.language())
+      && putString(result, feed.copyright()) && putString(result, feed.managingEditor())
+      && putString(result, feed.webMaster()) && fits;
+  putDate(result, feed.pubDate());
+  putDate(result, feed.lastBuildDate());
+  putCategories(result, feed.category(), table);
+  fits = putString(result, feed.generator()) && putString(result, feed.docs()) && fits;
+  const Cloud& cloud = feed.cloud();
+  fits = putString(result, cloud.domain()) && fits;
+  putNumber(result, cloud.port(), 2);
+  fits = putString(result, cloud.path()) && putString(result, cloud.registerProcedure()) && fits;
+  putNumber(result, static_cast<std::uint64_t>(cloud.protocol()), 1);
+  putNumber(result, static_cast<std::uint32_t>(feed.ttl()), 4);
+  const Image& image = feed.image();
+  fits = putString(result, image.url()) && putString(result, image.title())
+      && putString(result, image.link()) && fits;
+  putDimension(result, image.width());
+  putDimension(result, image.height());
+  fits = putString(result, image.description()) && putString(result, feed.rating()) && fits;
+  const TextInput& textInput = feed.textInput();
+  fits = putString(result, textInput.title()) && putString(result, textInput.description())
+      && putString(result, textInput.name()) && putString(result, textInput.link()) && fits;
+  putNumber(result, feed.skipHours().size(), 1);
+  for (const unsigned int hour : feed.skipHours())
+  {
+    putNumber(result, hour, 1);
+  }
+  putNumber(result, feed.skipDays().size(), 1);
+  for (const BasicRSS::Days day : feed.skipDays())
+  {
+    putNumber(result, static_cast<std::uint64_t>(day), 1);
+  }
+
+  putNumber(result, feed.items().size(), 4);
+  for (const auto& item : feed.items())
+  {
+    fits = putString(result, item.title()) && putString(result, item.link())
+        && putString(result, item.description()) && putString(result, item.author()) && fits;
+    putCategories(result, item.category(), table);
+    fits = putString(result, item.comments()) && fits;
+    const Enclosure& enclosure = item.enclosure();
+    fits = putString(result, enclosure.url()) && fits;
+    putNumber(result, enclosure.length(), 8);
+    fits = putString(result, enclosure.type()) && putString(result, item.guid().get()) && fits;
+    putNumber(result, item.guid().isPermaLink() ? 1 : 0, 1);
+    putDate(result, item.pubDate());
+    fits = putString(result, item.source().get()) && putString(result, item.source().url()) && fits;
+  } //for
+  if (!fits)
+    return false;
+  data = std::move(result);
+  return true;
+}
+
+bool Snapshot::fromBuffer(const char* data, const std::size_t size, Channel& feed)
+{
+  if ((data == nullptr) || (size < sizeof(cSnapshotSignature))
+      || (std::memcmp(data, cSnapshotSignature, sizeof(cSnapshotSignature)) != 0))
+    return false;
+  SnapshotReader reader(data + sizeof(cSnapshotSignature), size - sizeof(cSnapshotSignature));
+
+  std::uint32_t count = 0;
+  if (!reader.getCount(count))
+    return false;
+  std::vector<Category> table;
+  for (std::uint32_t i = 0; i < count; ++i)
+  {
+    std::string category;
+    std::string domain;
+    if (!reader.getString(category) || !reader.getString(domain))
+      return false;
+    table.push_back(Category(category, domain));
+  } //for
+
+  Channel result;
+  std::string title, link, description, text;
+  std::time_t date = Channel::NoDate;
+  std::set<Category> categories;
+  std::uint64_t number = 0;
+  if (!reader.getString(title) || !reader.getString(link) || !reader.getString(description))
+    return false;
+  result.setTitle(title);
+  result.setLink(link);
+  result.setDescription(description);
+  if (!reader.getString(text))
+    return false;
+  result.setLanguage(text);
+  if (!reader.getString(text))
+    return false;
+  result.setCopyright(text);
+  if (!reader.getString(text))
+    return false;
+  result.setManagingEditor(text);
+  if (!reader.getString(text))
+    return false;
+  result.setWebMaster(text);
+  if (!reader.getDate(date))
+    return false;
+  result.setPubDate(date);
+  if (!reader.getDate(date))
+    return false;
+  result.setLastBuildDate(date);
+  if (!reader.getCategories(categories, table))
+    return false;
+  result.setCategory(categories);
+  if (!reader.getString(text))
+    return false;
+  result.setGenerator(text);
+  if (!reader.getString(text))
+    return false;
+  result.setDocs(text);
+
+  std::string domain, path, registerProcedure;
+  std::uint64_t port = 0;
+  if (!reader.getString(domain) || !reader.getNumber(port, 2) || !reader.getString(path)
+      || !reader.getString(registerProcedure) || !reader.getNumber(number, 1)
+      || (number > static_cast<std::uint64_t>(Protocol::HttpPost)))
+    return false;
+  result.setCloud(Cloud(domain, static_cast<uint16_t>(port), path, registerProcedure,
+                        static_cast<Protocol>(number)));
+  if (!reader.getNumber(number, 4))
+    return false;
+  result.setTtl(static_cast<int>(static_cast<std::int32_t>(static_cast<std::uint32_t>(number))));
+
+  std::string url, imageTitle, imageLink;
+  std::optional<unsigned int> width, height;
+  if (!reader.getString(url) || !reader.getString(imageTitle) || !reader.getString(imageLink)
+      || !reader.getDimension(width) || !reader.getDimension(height) || !reader.getString(text))
+    return false;
+  result.setImage(Image(url, imageTitle, imageLink, width, height, text));
+  if (!reader.getString(text))
+    return false;
+  result.setRating(text);
+  std::string name;
+  if (!reader.getString(title) || !reader.getString(description) || !reader.getString(name)
+      || !reader.getString(link))
+    return false;
+  result.setTextInput(TextInput(title, description, name, link));
+
+  if (!reader.getNumber(number, 1))
+    return false;
+  std::set<unsigned int> skipHours;
+  for (std::uint64_t i = number; i > 0; --i)
+  {
+    std::uint64_t hour = 0;
+    if (!reader.getNumber(hour, 1) || (hour > 23))
+      return false;
+    skipHours.insert(static_cast<unsigned int>(hour));
+  } //for
+  result.setSkipHours(skipHours);
+  if (!reader.getNumber(number, 1))
+    return false;
+  std::set<BasicRSS::Days> skipDays;
+  for (std::uint64_t i = number; i > 0; --i)
+  {
+    std::uint64_t day = 0;
+    if (!reader.getNumber(day, 1) || (day > static_cast<std::uint64_t>(BasicRSS::Days::Sunday)))
+      return false;
+    skipDays.insert(static_cast<BasicRSS::Days>(day));
+  } //for
+  result.setSkipDays(skipDays);
+
+  if (!reader.getCount(count))
+    return false;
+  std::vector<Item> items;
+  //Every item takes more than 32 bytes, so a broken count cannot allocate much.
+  items.reserve(std::min<std::size_t>(count, size / 32));
+  for (std::uint32_t i = 0; i < count; ++i)
+  {
+    std::string author, comments, type, guid, source, sourceURL;
+    std::uint64_t length = 0;
+    std::uint64_t isPermaLink = 0;
+    if (!reader.getString(title) || !reader.getString(link) || !reader.getString(description)
+        || !reader.getString(author) || !reader.getCategories(categories, table)
+        || !reader.getString(comments) || !reader.getString(url) || !reader.getNumber(length, 8)
+        || !reader.getString(type) || !reader.getString(guid) || !reader.getNumber(isPermaLink, 1)
+        || !reader.getDate(date) || !reader.getString(source) || !reader.getString(sourceURL))
+      return false;
+    items.push_back(Item(title, link, description, author, categories, comments,
+                         Enclosure(url, length, type), GUID(guid, isPermaLink != 0),
+                         date, Source(source, sourceURL)));
+  } //for
+  //Anything after the items means that this is not a valid snapshot.
+  if (!reader.atEnd())
+    return false;
+  result.setItems(std::move(items));
+  feed = std::move(result);
+  return true;
+}
+
+bool Snapshot::toFile(const Channel& feed, const std::string& fileName)
+{
+  std::string data;
+  if (!toString(feed, data))
+    return false;
+  //A snapshot can be created again, so there is no need to flush it.
+  AtomicFile file;
+  return file.open(fileName) && file.write(data.data(), data.size())
+      && file.commit(AtomicFile::Sync::None);
+}
+
+bool Snapshot::fromFile(const std::string& fileName, Channel& feed)
+{
+  MappedFile mappedFile;
+  if (!mappedFile.open(fileName))
+    return false;
+  return fromBuffer(mappedFile.data(), mappedFile.size(), feed);
+}
+
+} //namespace
@@ -0,0 +1,88 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the feed merger.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef RSS20_SNAPSHOT_HPP
+#define RSS20_SNAPSHOT_HPP
+
+#include <cstddef>
+#include <string>
+#include "Channel.hpp"
+
+namespace RSS20
+{
+  /** \brief compact binary form of parsed RSS 2.0 feeds
+   *
+   * A snapshot stores a parsed feed, so that it can be loaded again without
+   * parsing its XML. Strings are stored with their length in front of them,
+   * numbers and dates have a fixed width, and categories are stored once in
+   * a table that the feed and its items refer to by index. All numbers are
+   * little endian, so snapshots do not depend on the machine.
+   */
+  class Snapshot
+  {
+    public:
+      /** \brief creates the snapshot of a feed
+       *
+       * \param feed  the feed
+       * \param data  variable that will be used to store the snapshot
+       * \return Returns true, if the snapshot was created.
+       * Returns false, if the feed is too large for the format.
+       */
+      static bool toString(const Channel& feed, std::string& data);
+
+
+      /** \brief loads a feed from a snapshot in memory
+       *
+       * \param data  pointer to the snapshot
+       * \param size  length of the snapshot in bytes
+       * \param feed  variable that will be used to store the loaded feed
+       * \return Returns true, if the feed could be loaded.
+       * Returns false, if the data is not a valid snapshot.
+       */
+      static bool fromBuffer(const char* data, const std::size_t size, Channel& feed);
+
+
+      /** \brief writes the snapshot of a feed to a file
+       *
+       * \param feed      the feed
+       * \param fileName  name of the file
+       * \return Returns true, if the snapshot was written.
+       * Returns false, if an error occurred.
+       * \remarks The file is replaced atomically, so readers never see a
+       *          partially written snapshot.
+       */
+      static bool toFile(const Channel& feed, const std::string& fileName);
+
+
+      /** \brief loads a feed from a snapshot file
+       *
+       * \param fileName  name of the file
+       * \param feed      variable that will be used to store the loaded feed
+       * \return Returns true, if the feed could be loaded.
+       * Returns false, if the file could not be read or is not a valid
+       * snapshot.
+       * \remarks The file is mapped into memory instead of being read into
+       *          a buffer first.
+       */
+      static bool fromFile(const std::string& fileName, Channel& feed);
+  }; //class
+} //namespace
+
+#endif // RSS20_SNAPSHOT_HPP
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the feed merger.
-    Copyright (C) 2015, 2022  Dirk Stolle
+    Copyright (C) 2015, 2022, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -23,7 +23,7 @@
 namespace RSS20
 {
 
-Source::Source(const std::string& _source, const std::string& url)
+Source::Source(const std::string_view _source, const std::string_view url)
 : m_source(_source),
   m_url(url)
 {
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the feed merger.
-    Copyright (C) 2015, 2022  Dirk Stolle
+    Copyright (C) 2015, 2022, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -22,6 +22,7 @@
 #define RSS20_SOURCE_HPP
 
 #include <string>
+#include <string_view>
 
 namespace RSS20
 {
@@ -33,7 +34,7 @@ namespace RSS20
        * \param _source text of the source element
        * \param url  the value of the URL attribute
        */
-      explicit Source(const std::string& _source = "", const std::string& url = "");
+      explicit Source(const std::string_view _source = "", const std::string_view url = "");
 
 
       /** \brief Gets the source name.
@@ -0,0 +1,835 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the feed merger.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "StreamParser.hpp"
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <string_view>
+#include <libxml/chvalid.h>
+#include "Parser.hpp"
+#include "../rfc822/Date.hpp"
+#include "../StringFunctions.hpp"
+#include "../xml/ElementName.hpp"
+#include "../xml/XMLNode.hpp"
+
+namespace RSS20
+{
+
+/* Returns the local name (i.e. without namespace prefix) of the reader's
+   current node, just like XMLNode::getNameAsString() does for DOM nodes. */
+static std::string localName(xmlTextReaderPtr reader)
+{
+  const xmlChar * name = xmlTextReaderConstLocalName(reader);
+  if (name == nullptr)
+    return std::string();
+  return reinterpret_cast<const char*>(name);
+}
+
+/* Returns the token of the local name of the reader's current node, just
+   like XMLNode::getElementName() does for DOM nodes. */
+static ElementName elementName(xmlTextReaderPtr reader)
+{
+  const xmlChar * name = xmlTextReaderConstLocalName(reader);
+  if (name == nullptr)
+    return ElementName::Unknown;
+  return elementNameFromString(reinterpret_cast<const char*>(name));
+}
+
+/* Returns the namespace URI of the reader's current node, or an empty string,
+   if the node is not in a namespace. */
+static std::string_view namespaceURI(xmlTextReaderPtr reader)
+{
+  const xmlChar * uri = xmlTextReaderConstNamespaceUri(reader);
+  if (uri == nullptr)
+    return std::string_view();
+  return reinterpret_cast<const char*>(uri);
+}
+
+/* Checks whether the reader's current node is a node that the DOM parser
+   skips between elements, i.e. a comment or a text node without content
+   other than whitespace. */
+static bool isBlankReaderNode(xmlTextReaderPtr reader)
+{
+  const int type = xmlTextReaderNodeType(reader);
+  if ((type == XML_READER_TYPE_COMMENT) || (type == XML_READER_TYPE_WHITESPACE)
+      || (type == XML_READER_TYPE_SIGNIFICANT_WHITESPACE))
+    return true;
+  if ((type != XML_READER_TYPE_TEXT) && (type != XML_READER_TYPE_CDATA))
+    return false;
+  const xmlChar * value = xmlTextReaderConstValue(reader);
+  if (value == nullptr)
+    return true;
+  for (const xmlChar * c = value; *c != 0; ++c)
+  {
+    if (!xmlIsBlank_ch(*c))
+      return false;
+  } //for
+  return true;
+}
+
+bool StreamParser::skipElement(xmlTextReaderPtr reader)
+{
+  if (xmlTextReaderIsEmptyElement(reader) == 1)
+    return true;
+  const int depth = xmlTextReaderDepth(reader);
+  while (xmlTextReaderRead(reader) == 1)
+  {
+    if ((xmlTextReaderNodeType(reader) == XML_READER_TYPE_END_ELEMENT)
+        && (xmlTextReaderDepth(reader) == depth))
+      return true;
+  } //while
+  return false;
+}
+
+bool StreamParser::textContent(xmlTextReaderPtr reader, std::string& content)
+{
+  content.clear();
+  if (xmlTextReaderIsEmptyElement(reader) == 1)
+    return true;
+  const int depth = xmlTextReaderDepth(reader);
+  bool firstChild = true;
+  bool useText = true;
+  while (xmlTextReaderRead(reader) == 1)
+  {
+    const int type = xmlTextReaderNodeType(reader);
+    const int currentDepth = xmlTextReaderDepth(reader);
+    if ((type == XML_READER_TYPE_END_ELEMENT) && (currentDepth == depth))
+      return true;
+    //Only direct children contribute to the content.
+    if (currentDepth != depth + 1)
+      continue;
+    const bool isText = (type == XML_READER_TYPE_TEXT)
+        || (type == XML_READER_TYPE_CDATA)
+        || (type == XML_READER_TYPE_WHITESPACE)
+        || (type == XML_READER_TYPE_SIGNIFICANT_WHITESPACE);
+    //Like the DOM parser: no content, if the first child is not text.
+    if (firstChild)
+    {
+      useText = isText;
+      firstChild = false;
+    }
+    if (useText && isText)
+    {
+      const xmlChar * value = xmlTextReaderConstValue(reader);
+      if (value != nullptr)
+        content += reinterpret_cast<const char*>(value);
+    }
+  } //while
+  return false;
+}
+
+StreamParser::AttributeList StreamParser::attributes(xmlTextReaderPtr reader)
+{
+  AttributeList attrs;
+  if (xmlTextReaderHasAttributes(reader) != 1)
+    return attrs;
+  while (xmlTextReaderMoveToNextAttribute(reader) == 1)
+  {
+    //The DOM does not list namespace declarations as attributes either.
+    if (xmlTextReaderIsNamespaceDecl(reader) == 1)
+      continue;
+    const xmlChar * value = xmlTextReaderConstValue(reader);
+    attrs.push_back(std::make_pair(localName(reader),
+        value == nullptr ? std::string() : std::string(reinterpret_cast<const char*>(value))));
+  } //while
+  xmlTextReaderMoveToElement(reader);
+  return attrs;
+}
+
+bool StreamParser::categoryFromReader(xmlTextReaderPtr reader, Category& categoryInfo)
+{
+  const AttributeList attrs = attributes(reader);
+  if (attrs.size() > 1)
+  {
+    std::cerr << "Error: Node <category> should have not more than one attribute!" << std::endl;
+    return false;
+  } //if
+  std::string content;
+  if (!textContent(reader, content))
+    return false;
+  categoryInfo = Category(content, "");
+  if (!attrs.empty())
+  {
+    if (attrs[0].first != "domain")
+    {
+      std::cerr << "Error: Node <category>'s attribute must be domain!" << std::endl;
+      return false;
+    } //if (inner)
+    categoryInfo.setDomain(attrs[0].second);
+  } //if
+  return !categoryInfo.empty();
+}
+
+bool StreamParser::enclosureFromReader(xmlTextReaderPtr reader, Enclosure& enclosureInfo)
+{
+  const AttributeList attrs = attributes(reader);
+  if (attrs.size() != 3)
+  {
+    std::cerr << "Enclosure element should have exactly three attributes, but "
+              << attrs.size() << " attributes were found instead."
+              << std::endl;
+    return false;
+  } //if not three attributes
+
+  //initialize element with empty values
+  enclosureInfo = Enclosure();
+  for (const auto& a : attrs)
+  {
+    if (a.first == "url")
+    {
+      if (!enclosureInfo.url().empty())
+      {
+        std::cerr << "Enclosure element already has URL!" << std::endl;
+        return false;
+      } //if URL was already specified
+      enclosureInfo.setUrl(a.second);
+    } //if URL
+    else if (a.first == "length")
+    {
+      if (enclosureInfo.length() > 0)
+      {
+        std::cerr << "Enclosure element already has a length!" << std::endl;
+        return false;
+      } //if length was already specified
+      unsigned int length = 0;
+      if (!stringToUnsignedInt(a.second, length))
+      {
+        std::cerr << "Error while parsing <enclosure>'s length: " << a.second
+                  << " is not an integer value!" << std::endl;
+        return false;
+      }
+      if (length == 0)
+      {
+        std::cerr << "Length value of <enclosure> element must be greater than zero." << std::endl;
+        return false;
+      }
+      enclosureInfo.setLength(length);
+    } //if length
+    else if (a.first == "type")
+    {
+      if (!enclosureInfo.type().empty())
+      {
+        std::cerr << "Enclosure element already has a type!" << std::endl;
+        return false;
+      } //if type was already specified
+      enclosureInfo.setType(a.second);
+    } //if type
+    else
+    {
+      std::cerr << "Error: found unknown attribute " << a.first
+                << " in <enclosure> element of RSS 2.0 channel!" << std::endl;
+      return false;
+    }
+  } //for
+
+  //Check, if all elements are set.
+  if (enclosureInfo.url().empty() || (enclosureInfo.length() <= 0)
+      || enclosureInfo.type().empty())
+  {
+    std::cerr << "Error: The <enclosure> element of the RSS 2.0 channel does not "
+              << "contain all the required information/attributes!" << std::endl;
+    return false;
+  } //if
+  return skipElement(reader);
+}
+
+bool StreamParser::itemChildFromReader(xmlTextReaderPtr reader, Item& theItem)
+{
+  const ElementName name = elementName(reader);
+  std::string content;
+  if (name == ElementName::Title)
+  {
+    if (!theItem.title().empty())
+    {
+      std::cerr << "Item already has a title!" << std::endl;
+      return false;
+    } //if title was already specified
+    if (!textContent(reader, content))
+      return false;
+    theItem.setTitle(content);
+  }
+  else if (name == ElementName::Link)
+  {
+    if (!theItem.link().empty())
+    {
+      std::cerr << "Item already has a link!" << std::endl;
+      return false;
+    } //if link was already specified
+    if (!textContent(reader, content))
+      return false;
+    theItem.setLink(content);
+  }
+  else if (name == ElementName::Description)
+  {
+    if (!theItem.description().empty())
+    {
+      std::cerr << "Item already has a description!" << std::endl;
+      return false;
+    } //if description was already specified
+    if (!textContent(reader, content))
+      return false;
+    theItem.setDescription(content);
+  }
+  else if (name == ElementName::Author)
+  {
+    if (!theItem.author().empty())
+    {
+      std::cerr << "Item already has a author!" << std::endl;
+      return false;
+    } //if author was already specified
+    if (!textContent(reader, content))
+      return false;
+    theItem.setAuthor(content);
+  }
+  else if (name == ElementName::Category)
+  {
+    Category cat;
+    if (!categoryFromReader(reader, cat))
+    {
+      std::cerr << "Could not parse RSS 2.0 <category> element!" << std::endl;
+      return false;
+    }
+    if (theItem.category().find(cat) != theItem.category().end())
+    {
+      std::cerr << "Item already has that category!" << std::endl;
+      return false;
+    } //if category was already specified
+    theItem.addCategory(std::move(cat));
+  }
+  else if (name == ElementName::Comments)
+  {
+    if (!theItem.comments().empty())
+    {
+      std::cerr << "Item already has a comment URL!" << std::endl;
+      return false;
+    } //if comments was already specified
+    if (!textContent(reader, content))
+      return false;
+    theItem.setComments(content);
+  }
+  else if (name == ElementName::Enclosure)
+  {
+    if (!theItem.enclosure().empty())
+    {
+      std::cerr << "Item already has an enclosure!" << std::endl;
+      return false;
+    }
+    Enclosure encl;
+    if (!enclosureFromReader(reader, encl))
+    {
+      std::cerr << "Could not parse RSS 2.0 <enclosure> element!" << std::endl;
+      return false;
+    }
+    theItem.setEnclosure(std::move(encl));
+  } //if enclosure
+  else if (name == ElementName::Guid)
+  {
+    if (!theItem.guid().empty())
+    {
+      std::cerr << "Item already has a GUID!" << std::endl;
+      return false;
+    }
+    const AttributeList attrs = attributes(reader);
+    bool permaLink = true;
+    if (!attrs.empty())
+    {
+      // The only allowed attribute for <guid> is "isPermaLink".
+      if (attrs[0].first != "isPermaLink")
+      {
+        std::cerr << "Error: <guid> may not have other attributes than "
+                  << "'isPermaLink', but " << attrs[0].first
+                  << " was found!" << std::endl;
+        return false;
+      } // if attribute is not "isPermaLink"
+      if (attrs[0].second == "true")
+        permaLink = true;
+      else if (attrs[0].second == "false")
+        permaLink = false;
+      else
+      {
+        std::cerr << "Error: Value of attribute isPermaLink in <guid> has "
+                  << "to be either \"true\" or \"false\", but it is \""
+                  << attrs[0].second << "\" instead." << std::endl;
+        return false;
+      } // else
+    } // if attribute is present
+    if (!textContent(reader, content))
+      return false;
+    theItem.setGUID(GUID(content, permaLink));
+  } // if GUID
+  else if (name == ElementName::PubDate)
+  {
+    if (theItem.pubDate() != BasicRSS::Channel::NoDate)
+    {
+      std::cerr << "Item already has a publication date!" << std::endl;
+      return false;
+    } //if pubDate was already specified
+    if (!textContent(reader, content))
+      return false;
+    std::time_t thePubDate = BasicRSS::Channel::NoDate;
+    if (!rfc822DateTimeToTimeT(content, thePubDate))
+    {
+      std::cerr << "Could not parse publication date \""
+                << content << "\"!" <<std::endl;
+      return false;
+    }
+    theItem.setPubDate(thePubDate);
+  }
+  else if (name == ElementName::Source)
+  {
+    if (!theItem.source().empty())
+    {
+      std::cerr << "Item's source was already set!" << std::endl;
+      return false;
+    } //if source was already specified
+    const AttributeList attrs = attributes(reader);
+    if (attrs.size() != 1)
+    {
+      std::cerr << "Error: Node <source> should have exactly one attribute!" << std::endl;
+      return false;
+    } //if
+    if (attrs[0].first != "url")
+    {
+      std::cerr << "Error: Node <source> should have a 'url' attribute!" << std::endl;
+      return false;
+    }
+    if (!textContent(reader, content))
+      return false;
+    Source src(content, attrs[0].second);
+    if (src.empty())
+    {
+      std::cerr << "Error: <source> node is (partially) empty." << std::endl;
+      return false;
+    }
+    theItem.setSource(std::move(src));
+  }
+  else
+  {
+    std::cerr << "Found unexpected node name within item: \"" << localName(reader)
+              << "\"!" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool StreamParser::itemFromReader(xmlTextReaderPtr reader, Item& theItem)
+{
+  theItem = Item("", "", "", "", std::set<Category>(), "", Enclosure(), GUID(),
+                 0, Source());
+  if (xmlTextReaderIsEmptyElement(reader) == 1)
+    return false;
+
+  const std::string itemNamespace(namespaceURI(reader));
+  const int depth = xmlTextReaderDepth(reader);
+  while (xmlTextReaderRead(reader) == 1)
+  {
+    const int type = xmlTextReaderNodeType(reader);
+    if ((type == XML_READER_TYPE_END_ELEMENT) && (xmlTextReaderDepth(reader) == depth))
+    {
+      //We are done here. Item should not be empty by now.
+      return !theItem.empty();
+    }
+    //Only direct children of the item are of interest here.
+    if (xmlTextReaderDepth(reader) != depth + 1)
+      continue;
+
+    if (type != XML_READER_TYPE_ELEMENT)
+    {
+      //Like the DOM parser: skip comments and whitespace only.
+      if (isBlankReaderNode(reader))
+        continue;
+      std::cerr << "Parser::itemFromNode: Expected element node, but current"
+                << " node is not an element node!" << std::endl;
+      return false;
+    }
+
+    //Elements of other namespaces (e.g. <dc:creator>) are extensions.
+    if (namespaceURI(reader) != itemNamespace)
+    {
+      if (!skipElement(reader))
+        return false;
+      continue;
+    }
+    if (!itemChildFromReader(reader, theItem))
+      return false;
+  } //while
+  return false;
+}
+
+bool StreamParser::channelFromReader(xmlTextReaderPtr reader, Channel& feed)
+{
+  if (xmlTextReaderIsEmptyElement(reader) == 1)
+  {
+    std::cerr << "Node <channel> has no child elements!";
+    return false;
+  }
+
+  //initialize empty channel / feed
+  feed = RSS20::Channel("", "", "", std::vector<Item>());
+
+  const std::string channelNamespace(namespaceURI(reader));
+  const int depth = xmlTextReaderDepth(reader);
+  std::string content;
+  while (xmlTextReaderRead(reader) == 1)
+  {
+    const int type = xmlTextReaderNodeType(reader);
+    if ((type == XML_READER_TYPE_END_ELEMENT) && (xmlTextReaderDepth(reader) == depth))
+      return true;
+    //Skip all non-element nodes (e.g. comment nodes).
+    if (type != XML_READER_TYPE_ELEMENT)
+      continue;
+
+    //Elements of other namespaces (e.g. <atom:link>) are extensions.
+    if (namespaceURI(reader) != channelNamespace)
+    {
+      if (!skipElement(reader))
+        return false;
+      continue;
+    }
+
+    const ElementName name = elementName(reader);
+    if (name == ElementName::Item)
+    {
+      Item it = Item("", "", "", "", std::set<Category>(), "", Enclosure(), GUID(),
+                     0, Source());
+      if (!itemFromReader(reader, it))
+      {
+        std::cerr << "Could not parse RSS 2.0 item!" << std::endl;
+        return false;
+      }
+      feed.addItem(std::move(it));
+    } //if item
+    else if ((name == ElementName::Title) || (name == ElementName::Link)
+        || (name == ElementName::Description) || (name == ElementName::Language)
+        || (name == ElementName::Copyright) || (name == ElementName::ManagingEditor)
+        || (name == ElementName::WebMaster) || (name == ElementName::Docs)
+        || (name == ElementName::Rating) || (name == ElementName::Generator))
+    {
+      if (!textContent(reader, content))
+        return false;
+      if (name == ElementName::Title)
+      {
+        if (!feed.title().empty())
+        {
+          std::cerr << "Feed already has a title!" << std::endl;
+          return false;
+        }
+        feed.setTitle(content);
+      }
+      else if (name == ElementName::Link)
+      {
+        if (!feed.link().empty())
+        {
+          std::cerr << "Feed already has a link!" << std::endl;
+          return false;
+        }
+        feed.setLink(content);
+      }
+      else if (name == ElementName::Description)
+      {
+        if (!feed.description().empty())
+        {
+          std::cerr << "Feed already has a description!" << std::endl;
+          return false;
+        }
+        feed.setDescription(content);
+      }
+      else if (name == ElementName::Language)
+      {
+        if (!feed.language().empty())
+        {
+          std::cerr << "Feed already has a language!" << std::endl;
+          return false;
+        }
+        feed.setLanguage(content);
+      }
+      else if (name == ElementName::Copyright)
+      {
+        if (!feed.copyright().empty())
+        {
+          std::cerr << "Feed already has a copyright notice!" << std::endl;
+          return false;
+        }
+        feed.setCopyright(content);
+      }
+      else if (name == ElementName::ManagingEditor)
+      {
+        if (!feed.managingEditor().empty())
+        {
+          std::cerr << "Feed already has an address for the managing editor!" << std::endl;
+          return false;
+        }
+        feed.setManagingEditor(content);
+      }
+      else if (name == ElementName::WebMaster)
+      {
+        if (!feed.webMaster().empty())
+        {
+          std::cerr << "Feed already has an address for the webmaster!" << std::endl;
+          return false;
+        }
+        feed.setWebMaster(content);
+      }
+      else if (name == ElementName::Docs)
+      {
+        if (!feed.docs().empty())
+        {
+          std::cerr << "Feed documentation URL was already set!" << std::endl;
+          return false;
+        }
+        feed.setDocs(content);
+      }
+      else if (name == ElementName::Rating)
+      {
+        if (!feed.rating().empty())
+        {
+          std::cerr << "Feed already has a rating!" << std::endl;
+          return false;
+        }
+        feed.setRating(content);
+      }
+      else
+      {
+        if (!feed.generator().empty())
+        {
+          std::cerr << "Feed generator was already set!" << std::endl;
+          return false;
+        }
+        feed.setGenerator(content);
+      }
+    } //if simple text element
+    else if ((name == ElementName::PubDate) || (name == ElementName::LastBuildDate))
+    {
+      const bool isPubDate = (name == ElementName::PubDate);
+      if ((isPubDate && (feed.pubDate() != 0))
+          || (!isPubDate && (feed.lastBuildDate() != 0)))
+      {
+        std::cerr << "Feed already has a " << (isPubDate ? "publication" : "last change")
+                  << " date!" << std::endl;
+        return false;
+      } //if date was already specified
+      if (!textContent(reader, content))
+        return false;
+      std::time_t theDate = 0;
+      if (!rfc822DateTimeToTimeT(content, theDate))
+      {
+        std::cerr << "Could not parse " << (isPubDate ? "publication" : "last change")
+                  << " date \"" << content << "\"!" << std::endl;
+        return false;
+      }
+      if (isPubDate)
+        feed.setPubDate(theDate);
+      else
+        feed.setLastBuildDate(theDate);
+    } //if pubDate or lastBuildDate
+    else if (name == ElementName::Category)
+    {
+      Category cat;
+      if (!categoryFromReader(reader, cat))
+      {
+        std::cerr << "Could not parse RSS 2.0 <category> element!" << std::endl;
+        return false;
+      }
+      if (feed.category().find(cat) != feed.category().end())
+      {
+        std::cerr << "Feed already has that category!" << std::endl;
+        return false;
+      } //if category was already specified
+      feed.addCategory(std::move(cat));
+    } //if category
+    else if (name == ElementName::Ttl)
+    {
+      if (feed.ttl() >= 0)
+      {
+        std::cerr << "Feed's TTL was already set!" << std::endl;
+        return false;
+      } //if TTL was already specified
+      if (!textContent(reader, content))
+        return false;
+      int ttl = -1;
+      if (!stringToInt(content, ttl))
+      {
+        std::cerr << "Error: \"" << content << "\" is not an integer value,"
+                  << " but TTL must be a (non-negative) integer." << std::endl;
+        return false;
+      }
+      if (ttl < 0)
+      {
+        std::cerr << "Feed's TTL must not be negative!" << std::endl;
+        return false;
+      }
+      feed.setTtl(ttl);
+    } //if ttl
+    else if ((name == ElementName::Image) || (name == ElementName::TextInput)
+        || (name == ElementName::SkipHours) || (name == ElementName::SkipDays)
+        || (name == ElementName::Cloud))
+    {
+      /* These elements appear at most once per feed, so expanding them into
+         a small subtree is cheap and allows to use the same code as the
+         DOM-based parser. */
+      const xmlNodePtr expanded = xmlTextReaderExpand(reader);
+      if (expanded == nullptr)
+        return false;
+      const XMLNode node(expanded);
+      bool errors = false;
+      if (name == ElementName::TextInput)
+      {
+        if (!feed.textInput().empty())
+        {
+          std::cerr << "Feed already has a text input element!" << std::endl;
+          return false;
+        } //if text input element was already specified
+        TextInput txIn;
+        if (!textInputFromNode(node, txIn))
+        {
+          std::cerr << "Could not parse RSS 2.0 <textInput> element!" << std::endl;
+          return false;
+        }
+        feed.setTextInput(std::move(txIn));
+      } //if textInput
+      else if (name == ElementName::Cloud)
+      {
+        if (!feed.cloud().empty())
+        {
+          std::cerr << "Feed's cloud information was already set!" << std::endl;
+          return false;
+        } //if <cloud> was already specified
+        Cloud cl;
+        if (!RSS20::Parser::cloudFromNode(node, cl))
+        {
+          std::cerr << "Could not parse RSS 2.0 <cloud> element!" << std::endl;
+          return false;
+        }
+        feed.setCloud(std::move(cl));
+      } //if cloud
+      else if (!commonChannelElementFromNode(node, feed, errors) || errors)
+      {
+        return false;
+      }
+      if (!skipElement(reader))
+        return false;
+    } //if element is expanded
+    else
+    {
+      std::cerr << "Found unexpected node name in channel: \"" << localName(reader) << "\"!"
+                << std::endl;
+      return false;
+    }
+  } //while
+  return false;
+}
+
+bool StreamParser::fromReader(xmlTextReaderPtr reader, Channel& feed)
+{
+  if (reader == nullptr)
+  {
+    std::cerr << "Could not parse XML file!" << std::endl;
+    return false;
+  }
+  const std::unique_ptr<xmlTextReader, decltype(&xmlFreeTextReader)> guard(reader, &xmlFreeTextReader);
+
+  //find root element
+  int ret = xmlTextReaderRead(reader);
+  while ((ret == 1) && (xmlTextReaderNodeType(reader) != XML_READER_TYPE_ELEMENT))
+  {
+    ret = xmlTextReaderRead(reader);
+  }
+  if (ret != 1)
+  {
+    if (ret < 0)
+      std::cerr << "Could not parse XML file!" << std::endl;
+    else
+      std::cerr << "Empty XML document!" << std::endl;
+    return false;
+  }
+
+  if (elementName(reader) != ElementName::Rss)
+  {
+    std::cerr << "Root element's name is not \"rss\" but \""
+              << localName(reader) << "\" instead." << std::endl;
+    return false;
+  }
+  const AttributeList attrs = attributes(reader);
+  if (attrs.empty() || (attrs[0].first != "version"))
+  {
+    std::cerr << "Root element has no \"version\" attribute!" << std::endl;
+    return false;
+  } //if
+  if (attrs[0].second != "2.0")
+  {
+    std::cerr << "Version of feed is not 2.0, but \""
+              << attrs[0].second << "\"!" << std::endl;
+    return false;
+  }
+  if (xmlTextReaderIsEmptyElement(reader) == 1)
+  {
+    std::cerr << "No child nodes after root node.\n";
+    return false;
+  }
+
+  //skip empty comment and text nodes
+  ret = xmlTextReaderRead(reader);
+  while ((ret == 1) && (xmlTextReaderNodeType(reader) != XML_READER_TYPE_ELEMENT)
+         && (xmlTextReaderNodeType(reader) != XML_READER_TYPE_END_ELEMENT))
+  {
+    ret = xmlTextReaderRead(reader);
+  }
+  if ((ret != 1) || (xmlTextReaderNodeType(reader) != XML_READER_TYPE_ELEMENT)
+      || (elementName(reader) != ElementName::Channel))
+  {
+    std::cerr << "Child node of <rss> node must be <channel> node!" << std::endl;
+    return false;
+  }
+
+  if (!channelFromReader(reader, feed))
+    return false;
+
+  //The rest of the document is not used, but it still has to be well-formed.
+  while ((ret = xmlTextReaderRead(reader)) == 1)
+  {
+  }
+  return ret == 0;
+}
+
+bool StreamParser::fromFile(const std::string& fileName, Channel& feed)
+{
+  return fromReader(xmlReaderForFile(fileName.c_str(), nullptr, 0), feed);
+}
+
+bool StreamParser::fromString(const std::string& source, Channel& feed)
+{
+  if (source.empty())
+    return false;
+  return fromBuffer(source.data(), source.size(), feed);
+}
+
+bool StreamParser::fromBuffer(const char* data, const std::size_t size, Channel& feed,
+                              const char* encoding, const int options)
+{
+  //libxml2 uses int for the buffer size.
+  if ((data == nullptr) || (size == 0)
+      || (size > static_cast<std::size_t>(std::numeric_limits<int>::max())))
+    return false;
+  return fromReader(xmlReaderForMemory(data, static_cast<int>(size), nullptr,
+                                       encoding, options), feed);
+}
+
+} //namespace
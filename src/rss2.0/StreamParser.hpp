@@ -0,0 +1,176 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the feed merger.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef RSS20_STREAMPARSER_HPP
+#define RSS20_STREAMPARSER_HPP
+
+#include <string>
+#include <utility>
+#include <vector>
+#include <libxml/xmlreader.h>
+#include "../basic-rss/Parser.hpp"
+#include "../xml/XMLDocument.hpp"
+#include "Channel.hpp"
+
+namespace RSS20
+{
+  /** \brief parser for RSS 2.0 feeds that reads the XML data in one pass
+   *
+   * In contrast to Parser, this parser does not build the XML tree of the
+   * whole document. It uses libxml2's xmlTextReader interface to walk the
+   * data and creates the items directly, so only the nodes of the current
+   * element are kept in memory. The results are the same as the results of
+   * Parser.
+   */
+  class StreamParser: public BasicRSS::Parser
+  {
+    public:
+      /** \brief parses the given file as RSS 2.0 feed
+       *
+       * \param fileName  the name of the file
+       * \param feed      variable that will be used to store the parsed result
+       * \return Returns true, if the file could be parsed.
+       * Returns false, if the file could not be parsed.
+       */
+      static bool fromFile(const std::string& fileName, Channel& feed);
+
+
+      /** \brief parses the given string as RSS 2.0 feed
+       *
+       * \param source  source code of the RSS 2.0 feed
+       * \param feed    variable that will be used to store the parsed result
+       * \return Returns true, if the string could be parsed as RSS 2.0.
+       * Returns false, if the string could not be parsed.
+       */
+      static bool fromString(const std::string& source, Channel& feed);
+
+
+      /** \brief parses the given memory buffer as RSS 2.0 feed
+       *
+       * \param data      pointer to the source code of the feed, does not need
+       *                  to be NUL-terminated
+       * \param size      length of the source code in bytes
+       * \param feed      variable that will be used to store the parsed result
+       * \param encoding  name of the feed's encoding, or nullptr to detect it
+       * \param options   combination of libxml2's xmlParserOption values
+       * \return Returns true, if the buffer could be parsed as RSS 2.0.
+       * Returns false, if the buffer could not be parsed.
+       */
+      static bool fromBuffer(const char* data, const std::size_t size, Channel& feed,
+                             const char* encoding = nullptr,
+                             const int options = XMLDocument::DefaultParseOptions);
+    private:
+      /** list of attributes, first = name, second = value */
+      typedef std::vector<std::pair<std::string, std::string> > AttributeList;
+
+
+      /** \brief parses the feed from a reader and frees the reader
+       *
+       * \param reader  the XML reader, may be nullptr
+       * \param feed    variable that will be used to store the parsed result
+       * \return Returns true, if the data could be parsed as RSS 2.0.
+       * Returns false otherwise.
+       */
+      static bool fromReader(xmlTextReaderPtr reader, Channel& feed);
+
+
+      /** \brief parses the <channel> element the reader is positioned on
+       *
+       * \param reader  the XML reader
+       * \param feed    variable that will be used to store the parsed result
+       * \return Returns true, if the channel could be parsed.
+       * Returns false otherwise.
+       */
+      static bool channelFromReader(xmlTextReaderPtr reader, Channel& feed);
+
+
+      /** \brief parses the <item> element the reader is positioned on
+       *
+       * \param reader   the XML reader
+       * \param theItem  variable that will be used to store the parsed result
+       * \return Returns true, if the item could be parsed.
+       * Returns false otherwise.
+       */
+      static bool itemFromReader(xmlTextReaderPtr reader, Item& theItem);
+
+
+      /** \brief parses the child element of an <item> the reader is positioned on
+       *
+       * \param reader   the XML reader
+       * \param theItem  the item parsed so far, receives the parsed element
+       * \return Returns true, if the element could be parsed.
+       * Returns false otherwise.
+       */
+      static bool itemChildFromReader(xmlTextReaderPtr reader, Item& theItem);
+
+
+      /** \brief parses the <category> element the reader is positioned on
+       *
+       * \param reader        the XML reader
+       * \param categoryInfo  variable that will be used to store the parsed result
+       * \return Returns true, if the category could be parsed.
+       * Returns false otherwise.
+       */
+      static bool categoryFromReader(xmlTextReaderPtr reader, Category& categoryInfo);
+
+
+      /** \brief parses the <enclosure> element the reader is positioned on
+       *
+       * \param reader         the XML reader
+       * \param enclosureInfo  variable that will be used to store the parsed result
+       * \return Returns true, if the enclosure could be parsed.
+       * Returns false otherwise.
+       */
+      static bool enclosureFromReader(xmlTextReaderPtr reader, Enclosure& enclosureInfo);
+
+
+      /** \brief gets the text content of the element the reader is positioned on
+       *
+       * \param reader   the XML reader
+       * \param content  variable that will be used to store the text
+       * \return Returns true, if the content could be read.
+       * Returns false, if the data ended unexpectedly or is malformed.
+       * \remarks Afterwards the reader is positioned on the end of the element.
+       *          The content is the same as XMLNode::getContentBoth() returns.
+       */
+      static bool textContent(xmlTextReaderPtr reader, std::string& content);
+
+
+      /** \brief gets the attributes of the element the reader is positioned on
+       *
+       * \param reader  the XML reader
+       * \return Returns the attributes of the element, without namespace
+       *         declarations.
+       */
+      static AttributeList attributes(xmlTextReaderPtr reader);
+
+
+      /** \brief moves the reader to the end of the current element
+       *
+       * \param reader  the XML reader
+       * \return Returns true, if the end of the element was reached.
+       * Returns false, if the data ended unexpectedly or is malformed.
+       */
+      static bool skipElement(xmlTextReaderPtr reader);
+  }; //class
+
+} //namespace
+
+#endif // RSS20_STREAMPARSER_HPP
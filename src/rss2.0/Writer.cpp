@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the feed merger.
-    Copyright (C) 2015, 2022  Dirk Stolle
+    Copyright (C) 2015, 2022, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -21,6 +21,7 @@
 #include "Writer.hpp"
 #include <iostream>
 #include <libxml/tree.h>
+#include "../GzipStream.hpp"
 #include "../rfc822/Date.hpp"
 
 namespace RSS20
@@ -41,7 +42,7 @@ bool Writer::writeCategory(const std::set<Category>& category, xmlTextWriterPtr
         int ret = xmlTextWriterStartElement(writer, reinterpret_cast<const xmlChar*>("category"));
         if (ret < 0)
         {
-          std::cout << "Error: Could not start <category> element!" << std::endl;
+          std::cerr << "Error: Could not start <category> element!" << std::endl;
           return false;
         }
         //attribute domain
@@ -51,7 +52,7 @@ bool Writer::writeCategory(const std::set<Category>& category, xmlTextWriterPtr
                     reinterpret_cast<const xmlChar*>(categ.domain().c_str()));
           if (ret < 0)
           {
-            std::cout << "Error: Could not write domain attribute of <category> element!" << std::endl;
+            std::cerr << "Error: Could not write domain attribute of <category> element!" << std::endl;
             return false;
           }
         } //if domain attribute is present
@@ -61,14 +62,14 @@ bool Writer::writeCategory(const std::set<Category>& category, xmlTextWriterPtr
                   reinterpret_cast<const xmlChar*>(categ.get().c_str()));
         if (ret < 0)
         {
-          std::cout << "Error: Could not write content of <category> element!" << std::endl;
+          std::cerr << "Error: Could not write content of <category> element!" << std::endl;
           return false;
         }
         //close category element
         ret = xmlTextWriterEndElement(writer);
         if (ret < 0)
         {
-          std::cout << "Error: Could not end <category> element!" << std::endl;
+          std::cerr << "Error: Could not end <category> element!" << std::endl;
           return false;
         } //if
       } //if categ is not empty
@@ -87,7 +88,7 @@ bool Writer::writeItem(const Item& item, xmlTextWriterPtr writer)
   int ret = xmlTextWriterStartElement(writer, reinterpret_cast<const xmlChar*>("item"));
   if (ret < 0)
   {
-    std::cout << "Error: Could not start <item> element!" << std::endl;
+    std::cerr << "Error: Could not start <item> element!" << std::endl;
     return false;
   }
 
@@ -98,7 +99,7 @@ bool Writer::writeItem(const Item& item, xmlTextWriterPtr writer)
               reinterpret_cast<const xmlChar*>(item.title().c_str()));
     if (ret < 0)
     {
-      std::cout << "Error: Could not write <title> element!" << std::endl;
+      std::cerr << "Error: Could not write <title> element!" << std::endl;
       return false;
     }
   } //if title
@@ -110,7 +111,7 @@ bool Writer::writeItem(const Item& item, xmlTextWriterPtr writer)
               reinterpret_cast<const xmlChar*>(item.link().c_str()));
     if (ret < 0)
     {
-      std::cout << "Error: Could not write <link> element!" << std::endl;
+      std::cerr << "Error: Could not write <link> element!" << std::endl;
       return false;
     }
   } //if link
@@ -122,7 +123,7 @@ bool Writer::writeItem(const Item& item, xmlTextWriterPtr writer)
               reinterpret_cast<const xmlChar*>(item.description().c_str()));
     if (ret < 0)
     {
-      std::cout << "Error: Could not write <description> element!" << std::endl;
+      std::cerr << "Error: Could not write <description> element!" << std::endl;
       return false;
     }
   } //if description
@@ -134,7 +135,7 @@ bool Writer::writeItem(const Item& item, xmlTextWriterPtr writer)
               reinterpret_cast<const xmlChar*>(item.author().c_str()));
     if (ret < 0)
     {
-      std::cout << "Error: Could not write <author> element!" << std::endl;
+      std::cerr << "Error: Could not write <author> element!" << std::endl;
       return false;
     }
   } //if author
@@ -152,7 +153,7 @@ bool Writer::writeItem(const Item& item, xmlTextWriterPtr writer)
               reinterpret_cast<const xmlChar*>(item.comments().c_str()));
     if (ret < 0)
     {
-      std::cout << "Error: Could not write <comments> element!" << std::endl;
+      std::cerr << "Error: Could not write <comments> element!" << std::endl;
       return false;
     }
   } //if comments
@@ -164,7 +165,7 @@ bool Writer::writeItem(const Item& item, xmlTextWriterPtr writer)
     ret = xmlTextWriterStartElement(writer, reinterpret_cast<const xmlChar*>("enclosure"));
     if (ret < 0)
     {
-      std::cout << "Error: Could not start <enclosure> element!" << std::endl;
+      std::cerr << "Error: Could not start <enclosure> element!" << std::endl;
       return false;
     }
     //attribute url
@@ -172,7 +173,7 @@ bool Writer::writeItem(const Item& item, xmlTextWriterPtr writer)
               reinterpret_cast<const xmlChar*>(item.enclosure().url().c_str()));
     if (ret < 0)
     {
-      std::cout << "Error: Could not write url attribute of <enclosure> element!" << std::endl;
+      std::cerr << "Error: Could not write url attribute of <enclosure> element!" << std::endl;
       return false;
     }
     //attribute length
@@ -180,7 +181,7 @@ bool Writer::writeItem(const Item& item, xmlTextWriterPtr writer)
               reinterpret_cast<const xmlChar*>(std::to_string(item.enclosure().length()).c_str()));
     if (ret < 0)
     {
-      std::cout << "Error: Could not write length attribute of <enclosure> element!" << std::endl;
+      std::cerr << "Error: Could not write length attribute of <enclosure> element!" << std::endl;
       return false;
     }
     //attribute type
@@ -188,14 +189,14 @@ bool Writer::writeItem(const Item& item, xmlTextWriterPtr writer)
               reinterpret_cast<const xmlChar*>(item.enclosure().type().c_str()));
     if (ret < 0)
     {
-      std::cout << "Error: Could not write type attribute of <enclosure> element!" << std::endl;
+      std::cerr << "Error: Could not write type attribute of <enclosure> element!" << std::endl;
       return false;
     }
     //close enclosure element
     ret = xmlTextWriterEndElement(writer);
     if (ret < 0)
     {
-      std::cout << "Error: Could not end <enclosure> element!" << std::endl;
+      std::cerr << "Error: Could not end <enclosure> element!" << std::endl;
       return false;
     } //if
   } //if enclosure
@@ -207,7 +208,7 @@ bool Writer::writeItem(const Item& item, xmlTextWriterPtr writer)
     ret = xmlTextWriterStartElement(writer, reinterpret_cast<const xmlChar*>("guid"));
     if (ret < 0)
     {
-      std::cout << "Error: Could not start <guid> element!" << std::endl;
+      std::cerr << "Error: Could not start <guid> element!" << std::endl;
       return false;
     }
     //write permaLink attribute, but only if it is false, because true is default
@@ -218,7 +219,7 @@ bool Writer::writeItem(const Item& item, xmlTextWriterPtr writer)
                 reinterpret_cast<const xmlChar*>("false"));
       if (ret < 0)
       {
-        std::cout << "Error: Could not write isPermaLink attribute of <guid> element!" << std::endl;
+        std::cerr << "Error: Could not write isPermaLink attribute of <guid> element!" << std::endl;
         return false;
       }
     } //if GUID is not a permanent link
@@ -227,14 +228,14 @@ bool Writer::writeItem(const Item& item, xmlTextWriterPtr writer)
               reinterpret_cast<const xmlChar*>(item.guid().get().c_str()));
     if (ret < 0)
     {
-      std::cout << "Error: Could not write content of <guid> element!" << std::endl;
+      std::cerr << "Error: Could not write content of <guid> element!" << std::endl;
       return false;
     }
     //close guid element
     ret = xmlTextWriterEndElement(writer);
     if (ret < 0)
     {
-      std::cout << "Error: Could not end <guid> element!" << std::endl;
+      std::cerr << "Error: Could not end <guid> element!" << std::endl;
       return false;
     } //if
   } //if guid
@@ -245,14 +246,14 @@ bool Writer::writeItem(const Item& item, xmlTextWriterPtr writer)
     std::string pubDate;
     if (!timeToRFC822String(item.pubDate(), pubDate))
     {
-      std::cout << "Error: Could not convert pubDate (time_t) to string!" << std::endl;
+      std::cerr << "Error: Could not convert pubDate (time_t) to string!" << std::endl;
       return false;
     } //if conversion failed
     ret = xmlTextWriterWriteElement(writer, reinterpret_cast<const xmlChar*>("pubDate"),
               reinterpret_cast<const xmlChar*>(pubDate.c_str()));
     if (ret < 0)
     {
-      std::cout << "Error: Could not write <pubDate> element!" << std::endl;
+      std::cerr << "Error: Could not write <pubDate> element!" << std::endl;
       return false;
     }
   } //if pubDate
@@ -264,7 +265,7 @@ bool Writer::writeItem(const Item& item, xmlTextWriterPtr writer)
     ret = xmlTextWriterStartElement(writer, reinterpret_cast<const xmlChar*>("source"));
     if (ret < 0)
     {
-      std::cout << "Error: Could not start <source> element!" << std::endl;
+      std::cerr << "Error: Could not start <source> element!" << std::endl;
       return false;
     }
 
@@ -273,7 +274,7 @@ bool Writer::writeItem(const Item& item, xmlTextWriterPtr writer)
                 reinterpret_cast<const xmlChar*>(item.source().url().c_str()));
     if (ret < 0)
     {
-      std::cout << "Error: Could not write url attribute of <source> element!" << std::endl;
+      std::cerr << "Error: Could not write url attribute of <source> element!" << std::endl;
       return false;
     }
     //write source
@@ -281,14 +282,14 @@ bool Writer::writeItem(const Item& item, xmlTextWriterPtr writer)
               reinterpret_cast<const xmlChar*>(item.source().get().c_str()));
     if (ret < 0)
     {
-      std::cout << "Error: Could not write content of <source> element!" << std::endl;
+      std::cerr << "Error: Could not write content of <source> element!" << std::endl;
       return false;
     }
     //close source element
     ret = xmlTextWriterEndElement(writer);
     if (ret < 0)
     {
-      std::cout << "Error: Could not end <source> element!" << std::endl;
+      std::cerr << "Error: Could not end <source> element!" << std::endl;
       return false;
     } //if
   } //if source
@@ -297,36 +298,23 @@ bool Writer::writeItem(const Item& item, xmlTextWriterPtr writer)
   ret = xmlTextWriterEndElement(writer);
   if (ret < 0)
   {
-    std::cout << "Error: Could not end <item> element!" << std::endl;
+    std::cerr << "Error: Could not end <item> element!" << std::endl;
     return false;
   }
   //Item was successfully written.
   return true;
 }
 
-bool Writer::toFile(const Channel& feed, const std::string& fileName)
+bool Writer::toWriter(const Channel& feed, xmlTextWriterPtr writer)
 {
-  xmlDocPtr document = nullptr;
-  xmlTextWriterPtr writer = nullptr;
-
-  /* Create a new XmlWriter for DOM, with no compression. */
-  writer = xmlNewTextWriterDoc(&document, 0);
   if (nullptr == writer)
-  {
-    std::cout << "Error: Could not create XML writer!" << std::endl;
-    if (nullptr != document)
-      xmlFreeDoc(document);
     return false;
-  } //if
 
   //start XML document - version 1.0, UTF-8 encoding
   int ret = xmlTextWriterStartDocument(writer, "1.0", "UTF-8", NULL);
   if (ret < 0)
   {
-    std::cout << "Error: Could not start XML document!" << std::endl;
-    xmlFreeTextWriter(writer);
-    if (nullptr != document)
-      xmlFreeDoc(document);
+    std::cerr << "Error: Could not start XML document!" << std::endl;
     return false;
   }
 
@@ -334,10 +322,7 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
   ret = xmlTextWriterStartElement(writer, reinterpret_cast<const xmlChar*>("rss"));
   if (ret < 0)
   {
-    std::cout << "Error: Could not write <rss> element!" << std::endl;
-    xmlFreeTextWriter(writer);
-    if (nullptr != document)
-      xmlFreeDoc(document);
+    std::cerr << "Error: Could not write <rss> element!" << std::endl;
     return false;
   }
 
@@ -345,10 +330,7 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
   ret = xmlTextWriterWriteAttribute(writer, reinterpret_cast<const xmlChar*>("version"), reinterpret_cast<const xmlChar*>("2.0"));
   if (ret < 0)
   {
-    std::cout << "Error: Could not add version attribute to <rss> element!" << std::endl;
-    xmlFreeTextWriter(writer);
-    if (nullptr != document)
-      xmlFreeDoc(document);
+    std::cerr << "Error: Could not add version attribute to <rss> element!" << std::endl;
     return false;
   }
 
@@ -356,10 +338,7 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
   ret = xmlTextWriterStartElement(writer, reinterpret_cast<const xmlChar*>("channel"));
   if (ret < 0)
   {
-    std::cout << "Error: Could not write <channel> element!" << std::endl;
-    xmlFreeTextWriter(writer);
-    if (nullptr != document)
-      xmlFreeDoc(document);
+    std::cerr << "Error: Could not write <channel> element!" << std::endl;
     return false;
   }
 
@@ -368,10 +347,7 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
             reinterpret_cast<const xmlChar*>(feed.title().c_str()));
   if (ret < 0)
   {
-    std::cout << "Error: Could not write <title> element!" << std::endl;
-    xmlFreeTextWriter(writer);
-    if (nullptr != document)
-      xmlFreeDoc(document);
+    std::cerr << "Error: Could not write <title> element!" << std::endl;
     return false;
   }
 
@@ -380,10 +356,7 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
             reinterpret_cast<const xmlChar*>(feed.link().c_str()));
   if (ret < 0)
   {
-    std::cout << "Error: Could not write <link> element!" << std::endl;
-    xmlFreeTextWriter(writer);
-    if (nullptr != document)
-      xmlFreeDoc(document);
+    std::cerr << "Error: Could not write <link> element!" << std::endl;
     return false;
   }
 
@@ -392,10 +365,7 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
             reinterpret_cast<const xmlChar*>(feed.description().c_str()));
   if (ret < 0)
   {
-    std::cout << "Error: Could not write <description> element!" << std::endl;
-    xmlFreeTextWriter(writer);
-    if (nullptr != document)
-      xmlFreeDoc(document);
+    std::cerr << "Error: Could not write <description> element!" << std::endl;
     return false;
   }
 
@@ -409,10 +379,7 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
               reinterpret_cast<const xmlChar*>(feed.language().c_str()));
     if (ret < 0)
     {
-      std::cout << "Error: Could not write <language> element!" << std::endl;
-      xmlFreeTextWriter(writer);
-      if (nullptr != document)
-        xmlFreeDoc(document);
+      std::cerr << "Error: Could not write <language> element!" << std::endl;
       return false;
     }
   } //if language
@@ -424,10 +391,7 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
               reinterpret_cast<const xmlChar*>(feed.copyright().c_str()));
     if (ret < 0)
     {
-      std::cout << "Error: Could not write <copyright> element!" << std::endl;
-      xmlFreeTextWriter(writer);
-      if (nullptr != document)
-        xmlFreeDoc(document);
+      std::cerr << "Error: Could not write <copyright> element!" << std::endl;
       return false;
     }
   } //if copyright
@@ -439,10 +403,7 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
               reinterpret_cast<const xmlChar*>(feed.managingEditor().c_str()));
     if (ret < 0)
     {
-      std::cout << "Error: Could not write <managingEditor> element!" << std::endl;
-      xmlFreeTextWriter(writer);
-      if (nullptr != document)
-        xmlFreeDoc(document);
+      std::cerr << "Error: Could not write <managingEditor> element!" << std::endl;
       return false;
     }
   } //if managingEditor
@@ -454,10 +415,7 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
               reinterpret_cast<const xmlChar*>(feed.webMaster().c_str()));
     if (ret < 0)
     {
-      std::cout << "Error: Could not write <webMaster> element!" << std::endl;
-      xmlFreeTextWriter(writer);
-      if (nullptr != document)
-        xmlFreeDoc(document);
+      std::cerr << "Error: Could not write <webMaster> element!" << std::endl;
       return false;
     }
   } //if webMaster
@@ -468,20 +426,14 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
     std::string pubDate;
     if (!timeToRFC822String(feed.pubDate(), pubDate))
     {
-      std::cout << "Error: Could not convert pubDate (time_t) to string!" << std::endl;
-      xmlFreeTextWriter(writer);
-      if (nullptr != document)
-        xmlFreeDoc(document);
+      std::cerr << "Error: Could not convert pubDate (time_t) to string!" << std::endl;
       return false;
     } //if conversion failed
     ret = xmlTextWriterWriteElement(writer, reinterpret_cast<const xmlChar*>("pubDate"),
               reinterpret_cast<const xmlChar*>(pubDate.c_str()));
     if (ret < 0)
     {
-      std::cout << "Error: Could not write <pubDate> element!" << std::endl;
-      xmlFreeTextWriter(writer);
-      if (nullptr != document)
-        xmlFreeDoc(document);
+      std::cerr << "Error: Could not write <pubDate> element!" << std::endl;
       return false;
     }
   } //if pubDate
@@ -492,17 +444,14 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
     std::string lastBuildDate;
     if (!timeToRFC822String(feed.lastBuildDate(), lastBuildDate))
     {
-      std::cout << "Error: Could not convert lastBuildDate (time_t) to string!" << std::endl;
+      std::cerr << "Error: Could not convert lastBuildDate (time_t) to string!" << std::endl;
       return false;
     } //if conversion failed
     ret = xmlTextWriterWriteElement(writer, reinterpret_cast<const xmlChar*>("lastBuildDate"),
               reinterpret_cast<const xmlChar*>(lastBuildDate.c_str()));
     if (ret < 0)
     {
-      std::cout << "Error: Could not write <lastBuildDate> element!" << std::endl;
-      xmlFreeTextWriter(writer);
-      if (nullptr != document)
-        xmlFreeDoc(document);
+      std::cerr << "Error: Could not write <lastBuildDate> element!" << std::endl;
       return false;
     }
   } //if lastBuildDate
@@ -510,9 +459,6 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
   //write <category>
   if (!writeCategory(feed.category(), writer))
   {
-    xmlFreeTextWriter(writer);
-    if (nullptr != document)
-      xmlFreeDoc(document);
     return false;
   } //category
 
@@ -523,10 +469,7 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
               reinterpret_cast<const xmlChar*>(feed.generator().c_str()));
     if (ret < 0)
     {
-      std::cout << "Error: Could not write <generator> element!" << std::endl;
-      xmlFreeTextWriter(writer);
-      if (nullptr != document)
-        xmlFreeDoc(document);
+      std::cerr << "Error: Could not write <generator> element!" << std::endl;
       return false;
     }
   } //if generator
@@ -538,10 +481,7 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
               reinterpret_cast<const xmlChar*>(feed.docs().c_str()));
     if (ret < 0)
     {
-      std::cout << "Error: Could not write <docs> element!" << std::endl;
-      xmlFreeTextWriter(writer);
-      if (nullptr != document)
-        xmlFreeDoc(document);
+      std::cerr << "Error: Could not write <docs> element!" << std::endl;
       return false;
     }
   } //if docs
@@ -553,10 +493,7 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
     ret = xmlTextWriterStartElement(writer, reinterpret_cast<const xmlChar*>("cloud"));
     if (ret < 0)
     {
-      std::cout << "Error: Could not start <cloud> element!" << std::endl;
-      xmlFreeTextWriter(writer);
-      if (nullptr != document)
-        xmlFreeDoc(document);
+      std::cerr << "Error: Could not start <cloud> element!" << std::endl;
       return false;
     }
     //attribute domain
@@ -564,10 +501,7 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
               reinterpret_cast<const xmlChar*>(feed.cloud().domain().c_str()));
     if (ret < 0)
     {
-      std::cout << "Error: Could not write domain attribute of <cloud> element!" << std::endl;
-      xmlFreeTextWriter(writer);
-      if (nullptr != document)
-        xmlFreeDoc(document);
+      std::cerr << "Error: Could not write domain attribute of <cloud> element!" << std::endl;
       return false;
     }
     //attribute port
@@ -575,10 +509,7 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
               reinterpret_cast<const xmlChar*>(std::to_string(feed.cloud().port()).c_str()));
     if (ret < 0)
     {
-      std::cout << "Error: Could not write port attribute of <cloud> element!" << std::endl;
-      xmlFreeTextWriter(writer);
-      if (nullptr != document)
-        xmlFreeDoc(document);
+      std::cerr << "Error: Could not write port attribute of <cloud> element!" << std::endl;
       return false;
     }
     //attribute path
@@ -586,10 +517,7 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
               reinterpret_cast<const xmlChar*>(feed.cloud().path().c_str()));
     if (ret < 0)
     {
-      std::cout << "Error: Could not write path attribute of <cloud> element!" << std::endl;
-      xmlFreeTextWriter(writer);
-      if (nullptr != document)
-        xmlFreeDoc(document);
+      std::cerr << "Error: Could not write path attribute of <cloud> element!" << std::endl;
       return false;
     }
     //attribute registerProcedure
@@ -597,10 +525,7 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
               reinterpret_cast<const xmlChar*>(feed.cloud().registerProcedure().c_str()));
     if (ret < 0)
     {
-      std::cout << "Error: Could not write registerProcedure attribute of <cloud> element!" << std::endl;
-      xmlFreeTextWriter(writer);
-      if (nullptr != document)
-        xmlFreeDoc(document);
+      std::cerr << "Error: Could not write registerProcedure attribute of <cloud> element!" << std::endl;
       return false;
     }
     //attribute protocol
@@ -609,20 +534,14 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
               reinterpret_cast<const xmlChar*>(proto_string.c_str()));
     if (ret < 0)
     {
-      std::cout << "Error: Could not write protocol attribute of <cloud> element!" << std::endl;
-      xmlFreeTextWriter(writer);
-      if (nullptr != document)
-        xmlFreeDoc(document);
+      std::cerr << "Error: Could not write protocol attribute of <cloud> element!" << std::endl;
       return false;
     }
     //close cloud element
     ret = xmlTextWriterEndElement(writer);
     if (ret < 0)
     {
-      std::cout << "Error: Could not end <cloud> element!" << std::endl;
-      xmlFreeTextWriter(writer);
-      if (nullptr != document)
-        xmlFreeDoc(document);
+      std::cerr << "Error: Could not end <cloud> element!" << std::endl;
       return false;
     }
   } //if cloud
@@ -634,10 +553,7 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
               reinterpret_cast<const xmlChar*>(std::to_string(feed.ttl()).c_str()));
     if (ret < 0)
     {
-      std::cout << "Error: Could not write <ttl> element!" << std::endl;
-      xmlFreeTextWriter(writer);
-      if (nullptr != document)
-        xmlFreeDoc(document);
+      std::cerr << "Error: Could not write <ttl> element!" << std::endl;
       return false;
     }
   } //if ttl
@@ -649,10 +565,7 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
     ret = xmlTextWriterStartElement(writer, reinterpret_cast<const xmlChar*>("image"));
     if (ret < 0)
     {
-      std::cout << "Error: Could not start <image> element!" << std::endl;
-      xmlFreeTextWriter(writer);
-      if (nullptr != document)
-        xmlFreeDoc(document);
+      std::cerr << "Error: Could not start <image> element!" << std::endl;
       return false;
     }
     /* required elements: url, title, link, so no check for emptiness */
@@ -661,10 +574,7 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
               reinterpret_cast<const xmlChar*>(feed.image().url().c_str()));
     if (ret < 0)
     {
-      std::cout << "Error: Could not write <url> element of <image>!" << std::endl;
-      xmlFreeTextWriter(writer);
-      if (nullptr != document)
-        xmlFreeDoc(document);
+      std::cerr << "Error: Could not write <url> element of <image>!" << std::endl;
       return false;
     }
     //write <title>
@@ -672,10 +582,7 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
               reinterpret_cast<const xmlChar*>(feed.image().title().c_str()));
     if (ret < 0)
     {
-      std::cout << "Error: Could not write <title> element of <image>!" << std::endl;
-      xmlFreeTextWriter(writer);
-      if (nullptr != document)
-        xmlFreeDoc(document);
+      std::cerr << "Error: Could not write <title> element of <image>!" << std::endl;
       return false;
     }
     //write <link>
@@ -683,10 +590,7 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
               reinterpret_cast<const xmlChar*>(feed.image().link().c_str()));
     if (ret < 0)
     {
-      std::cout << "Error: Could not write <title> element of <image>!" << std::endl;
-      xmlFreeTextWriter(writer);
-      if (nullptr != document)
-        xmlFreeDoc(document);
+      std::cerr << "Error: Could not write <title> element of <image>!" << std::endl;
       return false;
     }
     //write <width>
@@ -697,10 +601,7 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
                 reinterpret_cast<const xmlChar*>(std::to_string(feed.image().width().value()).c_str()));
       if (ret < 0)
       {
-        std::cout << "Error: Could not write <width> element of <image>!" << std::endl;
-        xmlFreeTextWriter(writer);
-        if (nullptr != document)
-          xmlFreeDoc(document);
+        std::cerr << "Error: Could not write <width> element of <image>!" << std::endl;
         return false;
       }
     } //if width
@@ -712,10 +613,7 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
                 reinterpret_cast<const xmlChar*>(std::to_string(feed.image().height().value()).c_str()));
       if (ret < 0)
       {
-        std::cout << "Error: Could not write <height> element of <image>!" << std::endl;
-        xmlFreeTextWriter(writer);
-        if (nullptr != document)
-          xmlFreeDoc(document);
+        std::cerr << "Error: Could not write <height> element of <image>!" << std::endl;
         return false;
       }
     } //if height
@@ -727,10 +625,7 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
                 reinterpret_cast<const xmlChar*>(feed.image().description().c_str()));
       if (ret < 0)
       {
-        std::cout << "Error: Could not write <description> element of <image>!" << std::endl;
-        xmlFreeTextWriter(writer);
-        if (nullptr != document)
-          xmlFreeDoc(document);
+        std::cerr << "Error: Could not write <description> element of <image>!" << std::endl;
         return false;
       }
     } //if description
@@ -738,10 +633,7 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
     ret = xmlTextWriterEndElement(writer);
     if (ret < 0)
     {
-      std::cout << "Error: Could not end <image> element!" << std::endl;
-      xmlFreeTextWriter(writer);
-      if (nullptr != document)
-        xmlFreeDoc(document);
+      std::cerr << "Error: Could not end <image> element!" << std::endl;
       return false;
     }
   } //if image
@@ -753,10 +645,7 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
               reinterpret_cast<const xmlChar*>(feed.rating().c_str()));
     if (ret < 0)
     {
-      std::cout << "Error: Could not write <rating> element!" << std::endl;
-      xmlFreeTextWriter(writer);
-      if (nullptr != document)
-        xmlFreeDoc(document);
+      std::cerr << "Error: Could not write <rating> element!" << std::endl;
       return false;
     }
   } //if rating
@@ -768,10 +657,7 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
     ret = xmlTextWriterStartElement(writer, reinterpret_cast<const xmlChar*>("textInput"));
     if (ret < 0)
     {
-      std::cout << "Error: Could not start <textInput> element!" << std::endl;
-      xmlFreeTextWriter(writer);
-      if (nullptr != document)
-        xmlFreeDoc(document);
+      std::cerr << "Error: Could not start <textInput> element!" << std::endl;
       return false;
     }
 
@@ -782,10 +668,7 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
               reinterpret_cast<const xmlChar*>(feed.textInput().title().c_str()));
     if (ret < 0)
     {
-      std::cout << "Error: Could not write <title> element of <textInput>!" << std::endl;
-      xmlFreeTextWriter(writer);
-      if (nullptr != document)
-        xmlFreeDoc(document);
+      std::cerr << "Error: Could not write <title> element of <textInput>!" << std::endl;
       return false;
     }
     //write <description>
@@ -793,10 +676,7 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
               reinterpret_cast<const xmlChar*>(feed.textInput().description().c_str()));
     if (ret < 0)
     {
-      std::cout << "Error: Could not write <description> element of <textInput>!" << std::endl;
-      xmlFreeTextWriter(writer);
-      if (nullptr != document)
-        xmlFreeDoc(document);
+      std::cerr << "Error: Could not write <description> element of <textInput>!" << std::endl;
       return false;
     }
     //write <name>
@@ -804,10 +684,7 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
               reinterpret_cast<const xmlChar*>(feed.textInput().name().c_str()));
     if (ret < 0)
     {
-      std::cout << "Error: Could not write <name> element of <textInput>!" << std::endl;
-      xmlFreeTextWriter(writer);
-      if (nullptr != document)
-        xmlFreeDoc(document);
+      std::cerr << "Error: Could not write <name> element of <textInput>!" << std::endl;
       return false;
     }
     //write <link>
@@ -815,10 +692,7 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
               reinterpret_cast<const xmlChar*>(feed.textInput().link().c_str()));
     if (ret < 0)
     {
-      std::cout << "Error: Could not write <link> element of <textInput>!" << std::endl;
-      xmlFreeTextWriter(writer);
-      if (nullptr != document)
-        xmlFreeDoc(document);
+      std::cerr << "Error: Could not write <link> element of <textInput>!" << std::endl;
       return false;
     }
 
@@ -826,10 +700,7 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
     ret = xmlTextWriterEndElement(writer);
     if (ret < 0)
     {
-      std::cout << "Error: Could not end <textInput> element!" << std::endl;
-      xmlFreeTextWriter(writer);
-      if (nullptr != document)
-        xmlFreeDoc(document);
+      std::cerr << "Error: Could not end <textInput> element!" << std::endl;
       return false;
     }
   } //if textInput
@@ -841,10 +712,7 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
     ret = xmlTextWriterStartElement(writer, reinterpret_cast<const xmlChar*>("skipHours"));
     if (ret < 0)
     {
-      std::cout << "Error: Could not start <skipHours> element!" << std::endl;
-      xmlFreeTextWriter(writer);
-      if (nullptr != document)
-        xmlFreeDoc(document);
+      std::cerr << "Error: Could not start <skipHours> element!" << std::endl;
       return false;
     }
     //write <hour> tags
@@ -854,10 +722,7 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
                 reinterpret_cast<const xmlChar*>(std::to_string(hour).c_str()));
       if (ret < 0)
       {
-        std::cout << "Error: Could not write <hour> element of <skipHours>!" << std::endl;
-        xmlFreeTextWriter(writer);
-        if (nullptr != document)
-          xmlFreeDoc(document);
+        std::cerr << "Error: Could not write <hour> element of <skipHours>!" << std::endl;
         return false;
       } //if failure
     } //for
@@ -865,10 +730,7 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
     ret = xmlTextWriterEndElement(writer);
     if (ret < 0)
     {
-      std::cout << "Error: Could not end <skipHours> element!" << std::endl;
-      xmlFreeTextWriter(writer);
-      if (nullptr != document)
-        xmlFreeDoc(document);
+      std::cerr << "Error: Could not end <skipHours> element!" << std::endl;
       return false;
     }
   } //if skipHours
@@ -880,10 +742,7 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
     ret = xmlTextWriterStartElement(writer, reinterpret_cast<const xmlChar*>("skipDays"));
     if (ret < 0)
     {
-      std::cout << "Error: Could not start <skipDays> element!" << std::endl;
-      xmlFreeTextWriter(writer);
-      if (nullptr != document)
-        xmlFreeDoc(document);
+      std::cerr << "Error: Could not start <skipDays> element!" << std::endl;
       return false;
     }
     //write <days>
@@ -893,10 +752,7 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
                 reinterpret_cast<const xmlChar*>(dayToString(day).c_str()));
       if (ret < 0)
       {
-        std::cout << "Error: Could not write <day> element of <skipDays>!" << std::endl;
-        xmlFreeTextWriter(writer);
-        if (nullptr != document)
-          xmlFreeDoc(document);
+        std::cerr << "Error: Could not write <day> element of <skipDays>!" << std::endl;
         return false;
       } //if failure
     } //for
@@ -904,10 +760,7 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
     ret = xmlTextWriterEndElement(writer);
     if (ret < 0)
     {
-      std::cout << "Error: Could not end <skipDays> element!" << std::endl;
-      xmlFreeTextWriter(writer);
-      if (nullptr != document)
-        xmlFreeDoc(document);
+      std::cerr << "Error: Could not end <skipDays> element!" << std::endl;
       return false;
     }
   } //if skipDays
@@ -920,12 +773,7 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
     for (const auto& item : feed.items())
     {
       if (!writeItem(item, writer))
-      {
-        xmlFreeTextWriter(writer);
-        if (nullptr != document)
-          xmlFreeDoc(document);
         return false;
-      }
     } //for
   } //if items
 
@@ -933,25 +781,170 @@ bool Writer::toFile(const Channel& feed, const std::string& fileName)
   ret = xmlTextWriterEndDocument(writer);
   if (ret < 0)
   {
-    std::cout << "Error: Could not end XML document!" << std::endl;
-    xmlFreeTextWriter(writer);
-    if (nullptr != document)
-      xmlFreeDoc(document);
+    std::cerr << "Error: Could not end XML document!" << std::endl;
     return false;
   }
+  return true;
+}
 
-  //free writer
+bool Writer::toOutput(const Channel& feed, xmlOutputBufferPtr output)
+{
+  if (nullptr == output)
+    return false;
+  /* The writer sends the XML data to the output while it is produced, so the
+     document never has to be held in memory as a whole. */
+  xmlTextWriterPtr writer = xmlNewTextWriter(output);
+  if (nullptr == writer)
+  {
+    std::cerr << "Error: Could not create XML writer!" << std::endl;
+    xmlOutputBufferClose(output);
+    return false;
+  } //if
+  //indent the same way as xmlSaveFormatFileEnc() does
+  if ((xmlTextWriterSetIndent(writer, 1) < 0)
+      || (xmlTextWriterSetIndentString(writer, reinterpret_cast<const xmlChar*>("  ")) < 0))
+  {
+    std::cerr << "Error: Could not set indentation of XML writer!" << std::endl;
+    xmlFreeTextWriter(writer);
+    return false;
+  }
+  const bool success = toWriter(feed, writer) && (xmlTextWriterFlush(writer) >= 0);
+  //free writer - this also closes the output
   xmlFreeTextWriter(writer);
   writer = nullptr;
-  //write file to file given by filename, using UTF-8 encoding and indenting
-  ret = xmlSaveFormatFileEnc(fileName.c_str(), document, "UTF-8", 1);
-  //free document - it's not used any more
-  xmlFreeDoc(document);
-  document = nullptr;
+  return success;
+}
+
+/* Destination of the serialised feed when it is written to a file: the file
+   itself and an optional gzip-compressed copy of it. */
+struct FileOutput
+{
+  AtomicFile* file; /**< the file */
+  GzipStream* gzip; /**< compressor of the copy, nullptr if there is none */
+};
+
+/* Callback for libxml2's output buffer: writes data to the file and to the
+   compressed copy, if any. */
+static int writeToFiles(void* context, const char* buffer, int len)
+{
+  FileOutput& output = *static_cast<FileOutput*>(context);
+  if (!output.file->write(buffer, len))
+    return -1;
+  if ((nullptr != output.gzip) && !output.gzip->write(buffer, len))
+    return -1;
+  return len;
+}
+
+bool Writer::toFile(const Channel& feed, const std::string& fileName,
+                    const AtomicFile::Sync sync, const bool gzipCopy)
+{
+  /* Readers of the file must never see a partially written feed, so the feed
+     is written to temporary files which replace the old files at the end.
+     The temporary files are removed automatically when anything fails. */
+  AtomicFile file;
+  if (!file.open(fileName))
+    return false;
+  AtomicFile gzipFile;
+  GzipStream gzip;
+  FileOutput output;
+  output.file = &file;
+  output.gzip = nullptr;
+  if (gzipCopy)
+  {
+    if (!gzipFile.open(fileName + ".gz"))
+      return false;
+    if (!gzip.open([&gzipFile](const char* data, const std::size_t size)
+                   { return gzipFile.write(data, size); }))
+    {
+      std::cerr << "Error: Could not initialize compression for "
+                << fileName << ".gz!" << std::endl;
+      return false;
+    }
+    output.gzip = &gzip;
+  }
+  xmlOutputBufferPtr buffer = xmlOutputBufferCreateIO(writeToFiles, nullptr, &output, nullptr);
+  const bool success = (nullptr != buffer) && toOutput(feed, buffer)
+                       && (!gzipCopy || gzip.finish());
   //Did the write fail?
-  if (ret < 0)
+  if (!success)
+  {
+    std::cerr << "Error: Could not write XML document to " << fileName << "!" << std::endl;
+    return false;
+  }
+  if (!file.commit(sync))
+    return false;
+  return !gzipCopy || gzipFile.commit(sync);
+}
+
+/* Callback for libxml2's output buffer: appends data to a std::string. */
+static int writeToString(void* context, const char* buffer, int len)
+{
+  static_cast<std::string*>(context)->append(buffer, len);
+  return len;
+}
+
+bool Writer::toString(const Channel& feed, std::string& output)
+{
+  output.clear();
+  xmlOutputBufferPtr buffer = xmlOutputBufferCreateIO(writeToString, nullptr, &output, nullptr);
+  if (nullptr == buffer)
+  {
+    std::cerr << "Error: Could not create XML output buffer!" << std::endl;
+    return false;
+  }
+  if (!toOutput(feed, buffer))
+  {
+    std::cerr << "Error: Could not write XML document to string!" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+/* Callback for libxml2's output buffer: appends data to a std::vector<char>. */
+static int writeToBuffer(void* context, const char* buffer, int len)
+{
+  std::vector<char>& output = *static_cast<std::vector<char>*>(context);
+  output.insert(output.end(), buffer, buffer + len);
+  return len;
+}
+
+bool Writer::toBuffer(const Channel& feed, std::vector<char>& output)
+{
+  output.clear();
+  xmlOutputBufferPtr buffer = xmlOutputBufferCreateIO(writeToBuffer, nullptr, &output, nullptr);
+  if (nullptr == buffer)
+  {
+    std::cerr << "Error: Could not create XML output buffer!" << std::endl;
+    return false;
+  }
+  if (!toOutput(feed, buffer))
+  {
+    std::cerr << "Error: Could not write XML document to buffer!" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+/* Callback for libxml2's output buffer: writes data to a std::ostream. */
+static int writeToStream(void* context, const char* buffer, int len)
+{
+  std::ostream& stream = *static_cast<std::ostream*>(context);
+  if (!stream.write(buffer, len))
+    return -1;
+  return len;
+}
+
+bool Writer::toStream(const Channel& feed, std::ostream& stream)
+{
+  xmlOutputBufferPtr buffer = xmlOutputBufferCreateIO(writeToStream, nullptr, &stream, nullptr);
+  if (nullptr == buffer)
+  {
+    std::cerr << "Error: Could not create XML output buffer!" << std::endl;
+    return false;
+  }
+  if (!toOutput(feed, buffer) || !stream.flush())
   {
-    std::cout << "Error: Could not write XML document to " << fileName << "!" << std::endl;
+    std::cerr << "Error: Could not write XML document to stream!" << std::endl;
     return false;
   }
   return true;
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the feed merger.
-    Copyright (C) 2015  Dirk Stolle
+    Copyright (C) 2015, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -21,7 +21,11 @@
 #ifndef RSS20_WRITER_HPP
 #define RSS20_WRITER_HPP
 
+#include <ostream>
+#include <string>
+#include <vector>
 #include <libxml/xmlwriter.h>
+#include "../AtomicFile.hpp"
 #include "Channel.hpp"
 
 namespace RSS20
@@ -34,11 +38,77 @@ namespace RSS20
        *
        * \param feed  the RSS 2.0 feed
        * \param fileName  name of the output file
+       * \param sync  policy for flushing the written file to the disk
+       * \param gzipCopy  whether to write a gzip-compressed copy of the file
+       *                  with the additional extension ".gz", too
        * \return Returns true, if file was written successfully.
        * Returns false, if an error occurred.
+       * \remarks The feed is streamed to the file while it is serialised,
+       * i.e. no DOM tree of the whole output is built in memory. It is written
+       * to a temporary file first, which replaces the output file atomically
+       * after it is complete. The compressed copy is written in the same pass.
        */
-      static bool toFile(const Channel& feed, const std::string& fileName);
+      static bool toFile(const Channel& feed, const std::string& fileName,
+                         const AtomicFile::Sync sync = AtomicFile::Sync::File,
+                         const bool gzipCopy = false);
+
+
+      /** \brief tries to write a given feed to a string
+       *
+       * \param feed  the RSS 2.0 feed
+       * \param output  string that will contain the XML document
+       * \return Returns true, if the feed was written successfully.
+       * Returns false, if an error occurred.
+       */
+      static bool toString(const Channel& feed, std::string& output);
+
+
+      /** \brief tries to write a given feed to a caller-supplied buffer
+       *
+       * \param feed  the RSS 2.0 feed
+       * \param output  buffer that will contain the XML document
+       * \return Returns true, if the feed was written successfully.
+       * Returns false, if an error occurred.
+       * \remarks The buffer is cleared first, but keeps its capacity. So a
+       * buffer that is reused for several feeds does not need to allocate
+       * new memory for each of them.
+       */
+      static bool toBuffer(const Channel& feed, std::vector<char>& output);
+
+
+      /** \brief tries to write a given feed to an output stream, e.g. std::cout
+       *
+       * \param feed  the RSS 2.0 feed
+       * \param stream  the stream that receives the XML document
+       * \return Returns true, if the feed was written successfully.
+       * Returns false, if an error occurred.
+       * \remarks The stream is flushed after the document has been written.
+       */
+      static bool toStream(const Channel& feed, std::ostream& stream);
+
+
+      /** \brief tries to write a given feed with the help of an XML text writer (libxml2)
+       *
+       * \param feed  the RSS 2.0 feed
+       * \param writer xmlTextWriterPtr for the writer
+       * \return Returns true, if the whole document was written successfully.
+       * Returns false, if an error occurred.
+       * \remarks The writer is not freed by this function. Items are passed
+       * to the writer one by one, so a writer that sends its output to a file
+       * or a buffer never needs to hold the complete document in memory.
+       */
+      static bool toWriter(const Channel& feed, xmlTextWriterPtr writer);
     private:
+      /** \brief tries to write a given feed to a libxml2 output buffer
+       *
+       * \param feed  the RSS 2.0 feed
+       * \param output  the output buffer, will be closed by this function
+       * \return Returns true, if the feed was written successfully.
+       * Returns false, if an error occurred.
+       */
+      static bool toOutput(const Channel& feed, xmlOutputBufferPtr output);
+
+
       /** \brief tries to write a category element with the help of an XML text writer (libxml2)
        *
        * \param cat   the category elements that shall be written
@@ -0,0 +1,69 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the feed merger.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "ElementName.hpp"
+#include <unordered_map>
+
+ElementName elementNameFromString(const std::string_view name)
+{
+  //The keys point to string literals, so they stay valid.
+  static const std::unordered_map<std::string_view, ElementName> names = {
+      { "author", ElementName::Author },
+      { "category", ElementName::Category },
+      { "channel", ElementName::Channel },
+      { "cloud", ElementName::Cloud },
+      { "comments", ElementName::Comments },
+      { "copyright", ElementName::Copyright },
+      { "day", ElementName::Day },
+      { "description", ElementName::Description },
+      { "docs", ElementName::Docs },
+      { "email", ElementName::Email },
+      { "enclosure", ElementName::Enclosure },
+      { "generator", ElementName::Generator },
+      { "guid", ElementName::Guid },
+      { "height", ElementName::Height },
+      { "hour", ElementName::Hour },
+      { "image", ElementName::Image },
+      { "item", ElementName::Item },
+      { "language", ElementName::Language },
+      { "lastBuildDate", ElementName::LastBuildDate },
+      { "link", ElementName::Link },
+      { "managingEditor", ElementName::ManagingEditor },
+      { "name", ElementName::Name },
+      { "pubDate", ElementName::PubDate },
+      { "rating", ElementName::Rating },
+      { "rss", ElementName::Rss },
+      { "skipDays", ElementName::SkipDays },
+      { "skipHours", ElementName::SkipHours },
+      { "source", ElementName::Source },
+      { "textInput", ElementName::TextInput },
+      { "textinput", ElementName::TextInputLowercase },
+      { "title", ElementName::Title },
+      { "ttl", ElementName::Ttl },
+      { "uri", ElementName::Uri },
+      { "url", ElementName::Url },
+      { "webMaster", ElementName::WebMaster },
+      { "width", ElementName::Width }
+  };
+  const auto iter = names.find(name);
+  if (iter == names.end())
+    return ElementName::Unknown;
+  return iter->second;
+}
@@ -0,0 +1,86 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the feed merger.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef ELEMENTNAME_HPP
+#define ELEMENTNAME_HPP
+
+#include <string_view>
+
+/** \brief element names that the feed parsers know
+ *
+ * Parsers compare the names of elements against these tokens instead of
+ * comparing strings, so dispatching on an element costs one lookup and
+ * does not allocate any memory.
+ */
+enum class ElementName
+{
+  /// any name that is not in the list below
+  Unknown,
+  Author,
+  Category,
+  Channel,
+  Cloud,
+  Comments,
+  Copyright,
+  Day,
+  Description,
+  Docs,
+  Email,
+  Enclosure,
+  Generator,
+  Guid,
+  Height,
+  Hour,
+  Image,
+  Item,
+  Language,
+  LastBuildDate,
+  Link,
+  ManagingEditor,
+  Name,
+  PubDate,
+  Rating,
+  Rss,
+  SkipDays,
+  SkipHours,
+  Source,
+  TextInput,
+  /// "textinput" of RSS 0.91, RSS 2.0 uses "textInput"
+  TextInputLowercase,
+  Title,
+  Ttl,
+  Uri,
+  Url,
+  WebMaster,
+  Width
+};
+
+
+/** \brief gets the token of an element name
+ *
+ * \param name  the local name of the element, i.e. without namespace prefix
+ * \return Returns the token of the name. Returns ElementName::Unknown, if
+ *         the name is not one of the known names.
+ * \remarks The comparison is case-sensitive, so "textinput" of RSS 0.91 and
+ *          "textInput" of RSS 2.0 get different tokens.
+ */
+ElementName elementNameFromString(const std::string_view name);
+
+#endif // ELEMENTNAME_HPP
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the Private Message Database.
-    Copyright (C) 2012, 2014, 2015  Dirk Stolle
+    Copyright (C) 2012, 2014, 2015, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -19,6 +19,7 @@
 */
 
 #include "XMLDocument.hpp"
+#include <limits>
 #include <stdexcept>
 
 XMLDocument::XMLDocument(const std::string& fileName)
@@ -31,23 +32,43 @@ XMLDocument::XMLDocument(xmlDocPtr doc)
   m_Doc(doc)
 {}
 
-XMLDocument::XMLDocument(const XMLDocument& op)
-: m_Doc(op.m_Doc==NULL ? NULL : xmlCopyDoc(op.m_Doc, 1))
+XMLDocument::XMLDocument(const char* data, const std::size_t size,
+                         const char* encoding, const int options)
+: m_Doc(NULL)
 {
+  //libxml2 uses int for the buffer size.
+  if ((data == nullptr) || (size == 0)
+      || (size > static_cast<std::size_t>(std::numeric_limits<int>::max())))
+    return;
+  m_Doc = xmlReadMemory(data, static_cast<int>(size), nullptr, encoding, options);
 }
 
-XMLDocument& XMLDocument::operator=(const XMLDocument& op)
+XMLDocument::XMLDocument(XMLDocument&& op) noexcept
+: m_Doc(op.m_Doc)
+{
+  op.m_Doc = NULL;
+}
+
+XMLDocument& XMLDocument::operator=(XMLDocument&& op) noexcept
 {
   if (this==&op) return *this;
   xmlFreeDoc(m_Doc);
-  m_Doc = NULL;
-  if (op.m_Doc!=NULL)
-  {
-    m_Doc = xmlCopyDoc(op.m_Doc, 1);
-  }
+  m_Doc = op.m_Doc;
+  op.m_Doc = NULL;
   return *this;
 }
 
+XMLDocument XMLDocument::clone() const
+{
+  if (m_Doc==NULL) return XMLDocument(static_cast<xmlDocPtr>(NULL));
+  return XMLDocument(xmlCopyDoc(m_Doc, 1));
+}
+
+XMLDocumentView XMLDocument::view() const
+{
+  return XMLDocumentView(m_Doc);
+}
+
 XMLDocument::~XMLDocument()
 {
   xmlFreeDoc(m_Doc);
@@ -55,22 +76,52 @@ XMLDocument::~XMLDocument()
 
 bool XMLDocument::isParsed() const
 {
-  return (m_Doc!=NULL);
+  return view().isParsed();
 }
 
 bool XMLDocument::isEmpty() const
 {
-  return (xmlDocGetRootElement(m_Doc)==NULL);
+  return view().isEmpty();
 }
 
 bool XMLDocument::wellFormed() const
+{
+  return view().wellFormed();
+}
+
+XMLNode XMLDocument::getRootNode() const
+{
+  return view().getRootNode();
+}
+
+XMLDocumentView::XMLDocumentView(const xmlDocPtr doc)
+: m_Doc(doc)
+{
+}
+
+XMLDocumentView::XMLDocumentView(const XMLDocument& doc)
+: m_Doc(doc.m_Doc)
+{
+}
+
+bool XMLDocumentView::isParsed() const
+{
+  return (m_Doc!=NULL);
+}
+
+bool XMLDocumentView::isEmpty() const
+{
+  return (xmlDocGetRootElement(m_Doc)==NULL);
+}
+
+bool XMLDocumentView::wellFormed() const
 {
   if (NULL!=m_Doc)
     return ((m_Doc->properties & XML_DOC_WELLFORMED) != 0);
   return false;
 }
 
-XMLNode XMLDocument::getRootNode() const
+XMLNode XMLDocumentView::getRootNode() const
 {
   if (!isParsed() or isEmpty())
     throw std::invalid_argument("XMLDocument::getRootNode(): XML document must be parsed and not empty, if you want to get the root node!");
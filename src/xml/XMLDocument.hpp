@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the Private Message Database.
-    Copyright (C) 2012, 2014, 2015  Dirk Stolle
+    Copyright (C) 2012, 2014, 2015, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -21,15 +21,76 @@
 #ifndef XMLDOCUMENT_HPP
 #define XMLDOCUMENT_HPP
 
+#include <cstddef>
 #include <string>
+#include <libxml/parser.h>
 #include <libxml/tree.h>
 #include "XMLNode.hpp"
 
+class XMLDocument;
+
+
+/** \brief non-owning view of a parsed libxml2 document
+ *
+ * A view is as cheap to copy as a pointer. It never frees the document, so
+ * the document has to outlive all of its views.
+ */
+class XMLDocumentView
+{
+  public:
+    /** \brief constructor
+     *
+     * \param doc  the document, may be nullptr
+     */
+    explicit XMLDocumentView(const xmlDocPtr doc = nullptr);
+
+
+    /** \brief creates a view of a document that is owned by an XMLDocument
+     *
+     * \param doc  the document
+     */
+    XMLDocumentView(const XMLDocument& doc);
+
+
+    /** returns true, if the document is parsed (i.e. a valid document) */
+    bool isParsed() const;
+
+    /** returns true, if the document is empty */
+    bool isEmpty() const;
+
+    /** returns true, if the document is well formed */
+    bool wellFormed() const;
+
+    /** returns the document's root node, or throws an exception if the document
+       is either not parsed or empty
+    */
+    XMLNode getRootNode() const;
+  private:
+    xmlDocPtr m_Doc;
+};//class
+
+
 /** \brief This is a C++-style wrapper class for libxml(2)'s xmlDoc type.
+ *
+ * An XMLDocument owns its document. It can be moved, but not copied, so
+ * that the tree is never duplicated by accident. Use clone() to get a deep
+ * copy and view() or XMLDocumentView to pass the document around without
+ * transferring the ownership.
 */
 class XMLDocument
 {
   public:
+    /** default options for parsing XML data from memory: no network access
+        and compact storage of short text nodes */
+    static const int DefaultParseOptions = XML_PARSE_NONET | XML_PARSE_COMPACT;
+
+
+    /** options for parsing XML data from memory, where whitespace between
+        elements does not matter: like the default options, but blank text
+        nodes are dropped instead of being stored in the document */
+    static const int NoBlanksParseOptions = DefaultParseOptions | XML_PARSE_NOBLANKS;
+
+
     /** \brief constructor
      *
      * \param fileName   path to the XML document that shall be wrapped inside this class
@@ -47,12 +108,60 @@ class XMLDocument
     XMLDocument(xmlDocPtr doc);
 
 
-    /** copy constructor */
-    XMLDocument(const XMLDocument& op);
+    /** \brief constructor to parse a document from memory
+     *
+     * \param data      pointer to the XML data, does not need to be
+     *                  NUL-terminated
+     * \param size      length of the XML data in bytes
+     * \param encoding  name of the document's encoding, or nullptr to detect
+     *                  it from the data
+     * \param options   combination of libxml2's xmlParserOption values
+     * \remarks The data is not copied and does not need to outlive the
+     * instance. Use isParsed() to check whether the data could be parsed.
+     */
+    XMLDocument(const char* data, const std::size_t size,
+                const char* encoding = nullptr,
+                const int options = DefaultParseOptions);
+
+
+    /** deleted copy constructor, use clone() to copy the document */
+    XMLDocument(const XMLDocument& op) = delete;
+
+
+    /** deleted copy assignment operator, use clone() to copy the document */
+    XMLDocument& operator=(const XMLDocument& op) = delete;
+
+
+    /** \brief move constructor
+     *
+     * \param op  the document to move, it is unparsed afterwards
+     */
+    XMLDocument(XMLDocument&& op) noexcept;
+
+
+    /** \brief move assignment operator
+     *
+     * \param op  the document to move, it is unparsed afterwards
+     */
+    XMLDocument& operator=(XMLDocument&& op) noexcept;
 
 
-    /** assignment operator */
-    XMLDocument& operator=(const XMLDocument& op);
+    /** \brief creates a deep copy of the document
+     *
+     * \return Returns a copy of the whole document tree. The copy is not
+     *         parsed, if this document is not parsed.
+     * \remarks Copying the tree is expensive for large documents. Consider
+     *          moving the document or passing a view instead.
+     */
+    XMLDocument clone() const;
+
+
+    /** \brief gets a non-owning view of the document
+     *
+     * \return Returns a view that is valid as long as the document exists
+     *         and is not moved or assigned to.
+     */
+    XMLDocumentView view() const;
 
 
     /** destructor */
@@ -73,6 +182,8 @@ class XMLDocument
     */
     XMLNode getRootNode() const;
   private:
+    friend class XMLDocumentView;
+
     xmlDocPtr m_Doc;
 };//class
 
@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the Private Message Database.
-    Copyright (C) 2012, 2013, 2014, 2015  Dirk Stolle
+    Copyright (C) 2012, 2013, 2014, 2015, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -20,7 +20,6 @@
 
 #include "XMLNode.hpp"
 #include <stdexcept>
-#include "../StringFunctions.hpp"
 
 XMLNode::XMLNode(const xmlNodePtr node)
 : m_Node(node)
@@ -39,6 +38,13 @@ std::string XMLNode::getNameAsString() const
   return reinterpret_cast<const char*>(m_Node->name);
 }
 
+ElementName XMLNode::getElementName() const
+{
+  if (m_Node->name == nullptr)
+    return ElementName::Unknown;
+  return elementNameFromString(reinterpret_cast<const char*>(m_Node->name));
+}
+
 bool XMLNode::hasChild() const
 {
   return (m_Node->children!=NULL);
@@ -104,15 +110,37 @@ std::string XMLNode::getCDATAText() const
 }
 
 std::string XMLNode::getContentBoth() const
+{
+  std::string buffer;
+  const std::string_view content = getContentView(buffer);
+  //The buffer is only used, if the content is not a view into the document.
+  if (content.data() == buffer.data())
+    return buffer;
+  return std::string(content);
+}
+
+std::string_view XMLNode::getContentView(std::string& buffer) const
 {
   //text is a child node of current node, so it has to have a child
-  if (NULL==m_Node->children) return "";
+  const xmlNodePtr child = m_Node->children;
+  if (NULL==child) return std::string_view();
   //type should be text or CDATA node
-  if ((m_Node->children->type!=XML_TEXT_NODE) and (m_Node->children->type!=XML_CDATA_SECTION_NODE)) return "";
-  xmlChar* key = xmlNodeListGetString(m_Node->doc, m_Node->children, 1);
-  std::string result = reinterpret_cast<const char*>(key);
+  if ((child->type!=XML_TEXT_NODE) and (child->type!=XML_CDATA_SECTION_NODE)) return std::string_view();
+  //A single text or CDATA node can be used as it is.
+  if (NULL==child->next)
+  {
+    if (NULL==child->content) return std::string_view();
+    return reinterpret_cast<const char*>(child->content);
+  }
+  xmlChar* key = xmlNodeListGetString(m_Node->doc, child, 1);
+  if (NULL==key)
+  {
+    buffer.clear();
+    return std::string_view();
+  }
+  buffer = reinterpret_cast<const char*>(key);
   xmlFree(key);//free it, because xmlNodeListGetString() allocated memory
-  return result;
+  return buffer;
 }
 
 std::string XMLNode::getFirstAttributeName() const
@@ -154,6 +182,77 @@ std::vector<std::pair<std::string, std::string> > XMLNode::getAttributes() const
   return attributeList;
 }
 
+XMLNode::AttributeViews XMLNode::getAttributeViews() const
+{
+  return AttributeViews(m_Node->properties);
+}
+
+XMLNode::AttributeViews::Iterator::Iterator(const xmlAttrPtr attribute)
+: m_Attribute(attribute)
+{
+}
+
+XMLNode::AttributeView XMLNode::AttributeViews::Iterator::operator*() const
+{
+  AttributeView view;
+  view.name = reinterpret_cast<const char*>(m_Attribute->name);
+  if ((m_Attribute->children != NULL) && (m_Attribute->children->content != NULL))
+    view.value = reinterpret_cast<const char*>(m_Attribute->children->content);
+  return view;
+}
+
+XMLNode::AttributeViews::Iterator& XMLNode::AttributeViews::Iterator::operator++()
+{
+  m_Attribute = m_Attribute->next;
+  return *this;
+}
+
+bool XMLNode::AttributeViews::Iterator::operator==(const Iterator& other) const
+{
+  return m_Attribute == other.m_Attribute;
+}
+
+bool XMLNode::AttributeViews::Iterator::operator!=(const Iterator& other) const
+{
+  return m_Attribute != other.m_Attribute;
+}
+
+XMLNode::AttributeViews::AttributeViews(const xmlAttrPtr first)
+: m_First(first)
+{
+}
+
+XMLNode::AttributeViews::Iterator XMLNode::AttributeViews::begin() const
+{
+  return Iterator(m_First);
+}
+
+XMLNode::AttributeViews::Iterator XMLNode::AttributeViews::end() const
+{
+  return Iterator(NULL);
+}
+
+std::size_t XMLNode::AttributeViews::size() const
+{
+  std::size_t count = 0;
+  for (xmlAttrPtr attribute = m_First; attribute != NULL; attribute = attribute->next)
+  {
+    ++count;
+  }
+  return count;
+}
+
+bool XMLNode::AttributeViews::empty() const
+{
+  return m_First == NULL;
+}
+
+std::string_view XMLNode::getNamespaceURI() const
+{
+  if ((NULL==m_Node->ns) or (NULL==m_Node->ns->href)) return std::string_view();
+  return reinterpret_cast<const char*>(m_Node->ns->href);
+}
+
 XMLNode XMLNode::getParent() const
 {
   return m_Node->parent;
@@ -179,10 +278,16 @@ bool XMLNode::isCommentNode() const
   return (m_Node->type==XML_COMMENT_NODE);
 }
 
+bool XMLNode::isBlankTextNode() const
+{
+  //xmlIsBlankNode() checks the content in place and returns zero for any
+  //node that is neither a text node nor a CDATA section.
+  return (xmlIsBlankNode(m_Node) != 0);
+}
+
 void XMLNode::skipEmptyCommentAndTextSiblings()
 {
-  while ((isCommentNode() or (isTextNode() and isEmptyOrWhitespace(getContentBoth())))
-          and hasNextSibling())
+  while ((isCommentNode() or isBlankTextNode()) and hasNextSibling())
   {
     m_Node = m_Node->next;
   } //while)
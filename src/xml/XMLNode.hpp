@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the Private Message Database.
-    Copyright (C) 2012, 2013, 2014, 2015  Dirk Stolle
+    Copyright (C) 2012, 2013, 2014, 2015, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -21,16 +21,85 @@
 #ifndef XMLNODE_HPP
 #define XMLNODE_HPP
 
+#include <cstddef>
+#include <iterator>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 #include <libxml/tree.h>
+#include "ElementName.hpp"
 
 /** \brief This is a C++-style wrapper class for libxml(2)'s xmlNodePtr type.
 */
 class XMLNode
 {
   public:
+    /** \brief name and value of an attribute, both borrowed from the document
+     *
+     * The views are valid as long as the XML document exists.
+     */
+    struct AttributeView
+    {
+      std::string_view name; /**< name of the attribute */
+      std::string_view value; /**< value of the attribute */
+    }; //struct
+
+
+    /** \brief range of the attributes of a node that reads them lazily
+     *
+     * The attributes are not copied. Iterating over them walks the
+     * attribute list of the node and yields views into the document.
+     */
+    class AttributeViews
+    {
+      public:
+        /** \brief forward iterator over the attributes */
+        class Iterator
+        {
+          public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = AttributeView;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const AttributeView*;
+            using reference = AttributeView;
+
+            /** \brief constructor
+             *
+             * \param attribute  the current attribute, nullptr for the end
+             */
+            explicit Iterator(const xmlAttrPtr attribute);
+
+            AttributeView operator*() const;
+            Iterator& operator++();
+            bool operator==(const Iterator& other) const;
+            bool operator!=(const Iterator& other) const;
+          private:
+            xmlAttrPtr m_Attribute; /**< current attribute */
+        }; //class
+
+
+        /** \brief constructor
+         *
+         * \param first  the first attribute of the node, may be nullptr
+         */
+        explicit AttributeViews(const xmlAttrPtr first);
+
+        Iterator begin() const;
+        Iterator end() const;
+
+
+        /** \brief returns the number of attributes by walking the list */
+        std::size_t size() const;
+
+
+        /** \brief returns true, if there are no attributes */
+        bool empty() const;
+      private:
+        xmlAttrPtr m_First; /**< first attribute of the node */
+    }; //class
+
+
     /** \brief constructor
      *
      * \param node - the libxml node pointer we are wrapping in this class
@@ -46,6 +115,12 @@ class XMLNode
     std::string getNameAsString() const;
 
 
+    /** returns the token of the node's name, without allocating any memory.
+        Names that the feed parsers do not know get ElementName::Unknown.
+    */
+    ElementName getElementName() const;
+
+
     /** returns true, if the node has at least one child node */
     bool hasChild() const;
 
@@ -103,6 +178,23 @@ class XMLNode
      */
     std::vector<std::pair<std::string, std::string> > getAttributes() const;
 
+
+    /** \brief returns the attributes of the node without copying them
+     *
+     * \return Returns a range of views of the attributes' names and values.
+     * \remarks Like getAttributes(), the value of an attribute is the
+     *          content of its first child node.
+     */
+    AttributeViews getAttributeViews() const;
+
+
+    /** \brief gets the URI of the node's namespace
+     *
+     * \return Returns the namespace URI of the node, or an empty view, if
+     *         the node is not in a namespace.
+     */
+    std::string_view getNamespaceURI() const;
+
     /** returns the parent of the node. Throws an exception, if there is no
        parent node.
     */
@@ -124,6 +216,15 @@ class XMLNode
     bool isCommentNode() const;
 
 
+    /** \brief checks whether the node is a text node or CDATA section that
+     *         contains nothing but whitespace
+     *
+     * \return Returns true, if the node is an empty or blank text node.
+     * \remarks The content is checked in place and is not copied.
+     */
+    bool isBlankTextNode() const;
+
+
     /** returns the text contained in the node, if it's a text node.  If there is no
         text node (or any child node), the function will return an empty string.
     */
@@ -144,7 +245,24 @@ class XMLNode
     std::string getContentBoth() const;
 
 
+    /** \brief gets the same content as getContentBoth(), but without copying
+     *         it, if possible
+     *
+     * \param buffer  string that holds the content, if it has to be put
+     *                together from several child nodes (e.g. text and entity
+     *                references); it is not touched otherwise
+     * \return Returns a view of the content. It points into the document, if
+     *         the content is a single text or CDATA node, and into buffer
+     *         otherwise.
+     */
+    std::string_view getContentView(std::string& buffer) const;
+
+
     /** \brief replaces the current node with its first non-empty, non-comment sibling node
+     *
+     * \remarks Comment nodes and blank text nodes are skipped, but the last
+     *          sibling is never skipped. So the node may still be a comment
+     *          or blank text node afterwards, if no element follows.
      */
     void skipEmptyCommentAndTextSiblings();
   private:
@@ -0,0 +1,127 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the feed merger.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include "XMLPushParser.hpp"
+#include <limits>
+
+XMLPushParser::XMLPushParser(const int options)
+: m_Context(nullptr),
+  m_Doc(nullptr),
+  m_Options(options),
+  m_Failed(false),
+  m_Finished(false)
+{
+}
+
+XMLPushParser::~XMLPushParser()
+{
+  reset();
+}
+
+void XMLPushParser::reset()
+{
+  if (nullptr != m_Context)
+  {
+    //A document that was not taken yet still belongs to the context.
+    if (nullptr != m_Context->myDoc)
+    {
+      xmlFreeDoc(m_Context->myDoc);
+      m_Context->myDoc = nullptr;
+    }
+    xmlFreeParserCtxt(m_Context);
+    m_Context = nullptr;
+  }
+  if (nullptr != m_Doc)
+  {
+    xmlFreeDoc(m_Doc);
+    m_Doc = nullptr;
+  }
+}
+
+bool XMLPushParser::push(const char* data, const std::size_t size)
+{
+  if (m_Failed || m_Finished)
+    return false;
+  if (nullptr == m_Context)
+  {
+    //Let libxml2 detect the encoding from the first bytes of the data.
+    m_Context = xmlCreatePushParserCtxt(nullptr, nullptr, nullptr, 0, nullptr);
+    if (nullptr == m_Context)
+    {
+      m_Failed = true;
+      return false;
+    }
+    xmlCtxtUseOptions(m_Context, m_Options);
+  }
+  std::size_t offset = 0;
+  while (offset < size)
+  {
+    //xmlParseChunk() takes an int as size, so huge chunks have to be split.
+    std::size_t part = size - offset;
+    if (part > static_cast<std::size_t>(std::numeric_limits<int>::max()))
+      part = std::numeric_limits<int>::max();
+    if (xmlParseChunk(m_Context, data + offset, static_cast<int>(part), 0) != 0)
+    {
+      m_Failed = true;
+      return false;
+    }
+    offset += part;
+  } //while
+  return true;
+}
+
+bool XMLPushParser::finish()
+{
+  if (m_Finished)
+    return !m_Failed && (nullptr != m_Doc);
+  m_Finished = true;
+  //no data at all
+  if (nullptr == m_Context)
+  {
+    m_Failed = true;
+    return false;
+  }
+  if (!m_Failed && (xmlParseChunk(m_Context, nullptr, 0, 1) != 0))
+    m_Failed = true;
+  if (!m_Failed && (m_Context->wellFormed == 0))
+    m_Failed = true;
+  if (m_Failed)
+  {
+    reset();
+    return false;
+  }
+  m_Doc = m_Context->myDoc;
+  m_Context->myDoc = nullptr;
+  xmlFreeParserCtxt(m_Context);
+  m_Context = nullptr;
+  return nullptr != m_Doc;
+}
+
+bool XMLPushParser::failed() const
+{
+  return m_Failed;
+}
+
+xmlDocPtr XMLPushParser::takeDocument()
+{
+  xmlDocPtr doc = m_Doc;
+  m_Doc = nullptr;
+  return doc;
+}
@@ -0,0 +1,97 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the feed merger.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#ifndef XMLPUSHPARSER_HPP
+#define XMLPUSHPARSER_HPP
+
+#include <cstddef>
+#include <libxml/parser.h>
+
+/** \brief Wrapper for libxml2's push parser, which builds an XML document
+ *         from data that arrives in chunks, e.g. during a network transfer.
+ */
+class XMLPushParser
+{
+  public:
+    /** \brief constructor
+     *
+     * \param options  combination of libxml2's xmlParserOption values
+     */
+    explicit XMLPushParser(const int options = 0);
+
+
+    /** delete copy constructor */
+    XMLPushParser(const XMLPushParser& op) = delete;
+
+
+    /** delete assignment operator */
+    XMLPushParser& operator=(const XMLPushParser& op) = delete;
+
+
+    /** destructor */
+    ~XMLPushParser();
+
+
+    /** \brief parses the next chunk of data
+     *
+     * \param data  pointer to the chunk
+     * \param size  size of the chunk in bytes
+     * \return Returns true, if the chunk could be parsed.
+     *         Returns false, if the data is not well-formed XML so far or if
+     *         finish() was already called.
+     */
+    bool push(const char* data, const std::size_t size);
+
+
+    /** \brief signals the end of the data and completes the document
+     *
+     * \return Returns true, if the whole data was a well-formed XML document.
+     *         Returns false otherwise.
+     */
+    bool finish();
+
+
+    /** \brief checks whether an error occurred during parsing
+     *
+     * \return Returns true, if the data was not well-formed.
+     */
+    bool failed() const;
+
+
+    /** \brief gets the parsed document and passes its ownership to the caller
+     *
+     * \return Returns the parsed document, if finish() was successful.
+     *         Returns nullptr otherwise, or if the document was already taken.
+     * \remarks The caller has to free the document, e.g. by wrapping it into
+     *          an XMLDocument instance.
+     */
+    xmlDocPtr takeDocument();
+  private:
+    /** \brief frees the parser context and the document, if any */
+    void reset();
+
+    xmlParserCtxtPtr m_Context; /**< parser context, created on first use */
+    xmlDocPtr m_Doc;            /**< document after finish() */
+    int m_Options;              /**< libxml2 parser options */
+    bool m_Failed;              /**< whether an error occurred */
+    bool m_Finished;            /**< whether finish() was called */
+}; //class
+
+#endif // XMLPUSHPARSER_HPP
@@ -0,0 +1,120 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the test suite for feed merger.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include <catch.hpp>
+#include <ctime>
+#include "../../src/JobFile.hpp"
+#include "../../src/rss2.0/Channel.hpp"
+
+TEST_CASE("JobFile")
+{
+  using Key = RSS20::Deduplicator::Key;
+  using Prefer = RSS20::Deduplicator::Prefer;
+  std::vector<JobFile::Job> jobs;
+
+  SECTION("several jobs with shared sources")
+  {
+    const std::string content = "# two merged feeds\n"
+        "[news]\n"
+        "output = news.xml\n"
+        "source = https://example.com/a.xml\n"
+        "source = feeds/b.xml\n"
+        "\n"
+        "; the second one\n"
+        "[ digest ]\r\n"
+        "  output=digest.xml  \r\n"
+        "source = https://example.com/a.xml\r\n"
+        "max-items = 20\r\n"
+        "since = Sun, 01 Mar 2026 00:00:00 GMT\r\n"
+        "dedup = guid,link\r\n";
+    REQUIRE( JobFile::parse(content, jobs) );
+    REQUIRE( jobs.size() == 2 );
+
+    REQUIRE( jobs[0].name == "news" );
+    REQUIRE( jobs[0].output == "news.xml" );
+    REQUIRE( jobs[0].sources == std::vector<std::string>({ "https://example.com/a.xml", "feeds/b.xml" }) );
+    REQUIRE( jobs[0].maxItems == 0 );
+    REQUIRE( jobs[0].since == RSS20::Channel::NoDate );
+    REQUIRE( jobs[0].dedupKeys.empty() );
+    REQUIRE( jobs[0].dedupPrefer == Prefer::Newest );
+
+    REQUIRE( jobs[1].name == "digest" );
+    REQUIRE( jobs[1].output == "digest.xml" );
+    REQUIRE( jobs[1].sources == std::vector<std::string>({ "https://example.com/a.xml" }) );
+    REQUIRE( jobs[1].maxItems == 20 );
+    //Dates are read as local time, like std::mktime() does it.
+    std::tm since = {};
+    since.tm_year = 126;
+    since.tm_mon = 2;
+    since.tm_mday = 1;
+    since.tm_isdst = -1;
+    REQUIRE( jobs[1].since == std::mktime(&since) );
+    REQUIRE( jobs[1].dedupKeys == std::vector<Key>({ Key::Guid, Key::Link }) );
+  }
+
+  SECTION("preferred copy of duplicates")
+  {
+    REQUIRE( JobFile::parse("[a]\noutput = a.xml\nsource = a.xml\ndedup = link\ndedup-prefer = first\n", jobs) );
+    REQUIRE( jobs[0].dedupKeys == std::vector<Key>({ Key::Link }) );
+    REQUIRE( jobs[0].dedupPrefer == Prefer::FirstFeed );
+    //A preference alone implies the default keys.
+    REQUIRE( JobFile::parse("[a]\noutput = a.xml\nsource = a.xml\ndedup-prefer = newest\n", jobs) );
+    REQUIRE( jobs[0].dedupKeys == RSS20::Deduplicator().keys() );
+    REQUIRE( jobs[0].dedupPrefer == Prefer::Newest );
+  }
+
+  SECTION("missing keys")
+  {
+    REQUIRE_FALSE( JobFile::parse("", jobs) );
+    REQUIRE_FALSE( JobFile::parse("[a]\nsource = a.xml\n", jobs) );
+    REQUIRE_FALSE( JobFile::parse("[a]\noutput = a.xml\n", jobs) );
+    // The first job is incomplete, too.
+    REQUIRE_FALSE( JobFile::parse("[a]\noutput = a.xml\n[b]\noutput = b.xml\nsource = b.xml\n", jobs) );
+  }
+
+  SECTION("invalid lines")
+  {
+    REQUIRE_FALSE( JobFile::parse("output = a.xml\n", jobs) );
+    REQUIRE_FALSE( JobFile::parse("[a\noutput = a.xml\nsource = a.xml\n", jobs) );
+    REQUIRE_FALSE( JobFile::parse("[]\noutput = a.xml\nsource = a.xml\n", jobs) );
+    REQUIRE_FALSE( JobFile::parse("[a]\noutput a.xml\nsource = a.xml\n", jobs) );
+    REQUIRE_FALSE( JobFile::parse("[a]\noutput =\nsource = a.xml\n", jobs) );
+    REQUIRE_FALSE( JobFile::parse("[a]\noutput = a.xml\nsource = a.xml\ncolour = blue\n", jobs) );
+    REQUIRE_FALSE( JobFile::parse("[a]\noutput = a.xml\nsource = a.xml\nmax-items = 0\n", jobs) );
+    REQUIRE_FALSE( JobFile::parse("[a]\noutput = a.xml\nsource = a.xml\nsince = yesterday\n", jobs) );
+    REQUIRE_FALSE( JobFile::parse("[a]\noutput = a.xml\nsource = a.xml\ndedup = guid,foo\n", jobs) );
+    REQUIRE_FALSE( JobFile::parse("[a]\noutput = a.xml\nsource = a.xml\ndedup-prefer = oldest\n", jobs) );
+  }
+
+  SECTION("conflicts between jobs")
+  {
+    REQUIRE_FALSE( JobFile::parse("[a]\noutput = a.xml\nsource = a.xml\n[a]\noutput = b.xml\nsource = b.xml\n", jobs) );
+    REQUIRE_FALSE( JobFile::parse("[a]\noutput = x.xml\nsource = a.xml\n[b]\noutput = x.xml\nsource = b.xml\n", jobs) );
+    REQUIRE_FALSE( JobFile::parse("[a]\noutput = a.xml\noutput = b.xml\nsource = a.xml\n", jobs) );
+  }
+
+  SECTION("failed parsing keeps previous jobs")
+  {
+    REQUIRE( JobFile::parse("[a]\noutput = a.xml\nsource = a.xml\n", jobs) );
+    REQUIRE_FALSE( JobFile::parse("[b]\n", jobs) );
+    REQUIRE( jobs.size() == 1 );
+    REQUIRE( jobs[0].name == "a" );
+  }
+}
@@ -0,0 +1,130 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the test suite for feed merger.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include <catch.hpp>
+#include "../../src/RefreshScheduler.hpp"
+
+TEST_CASE("RefreshScheduler")
+{
+  using BasicRSS::Days;
+  //Tue, 10 Jun 2003 04:00:00 GMT
+  const std::time_t tuesday = 1055217600;
+
+  SECTION("all sources are due at the start")
+  {
+    const RefreshScheduler scheduler(3, 600);
+    REQUIRE( scheduler.due(tuesday) == std::vector<std::size_t>({ 0, 1, 2 }) );
+    REQUIRE( scheduler.nextRefresh() == 0 );
+  }
+
+  SECTION("no sources")
+  {
+    const RefreshScheduler scheduler(0, 600);
+    REQUIRE( scheduler.due(tuesday).empty() );
+    REQUIRE( scheduler.nextRefresh() == 0 );
+  }
+
+  SECTION("default interval")
+  {
+    RefreshScheduler scheduler(2, 600);
+    RSS20::Channel feed;
+    scheduler.refreshed(0, feed, tuesday);
+    REQUIRE( scheduler.refreshTime(0) == tuesday + 600 );
+    REQUIRE( scheduler.due(tuesday) == std::vector<std::size_t>({ 1 }) );
+    scheduler.refreshed(1, feed, tuesday + 100);
+    REQUIRE( scheduler.due(tuesday + 599).empty() );
+    REQUIRE( scheduler.nextRefresh() == tuesday + 600 );
+    REQUIRE( scheduler.due(tuesday + 700) == std::vector<std::size_t>({ 0, 1 }) );
+  }
+
+  SECTION("ttl is honoured when it is longer than the interval")
+  {
+    RefreshScheduler scheduler(1, 600);
+    RSS20::Channel feed;
+    feed.setTtl(60);
+    scheduler.refreshed(0, feed, tuesday);
+    REQUIRE( scheduler.refreshTime(0) == tuesday + 3600 );
+
+    feed.setTtl(5);
+    scheduler.refreshed(0, feed, tuesday);
+    REQUIRE( scheduler.refreshTime(0) == tuesday + 600 );
+  }
+
+  SECTION("failed refresh is retried after the interval")
+  {
+    RefreshScheduler scheduler(1, 600);
+    scheduler.failed(0, tuesday);
+    REQUIRE( scheduler.refreshTime(0) == tuesday + 600 );
+  }
+
+  SECTION("skipHours")
+  {
+    RSS20::Channel feed;
+    feed.setSkipHours({ 4, 5, 7 });
+    REQUIRE( RefreshScheduler::firstAllowedTime(feed, tuesday + 1800) == tuesday + 2 * 3600 );
+    REQUIRE( RefreshScheduler::firstAllowedTime(feed, tuesday + 2 * 3600 + 5) == tuesday + 2 * 3600 + 5 );
+    REQUIRE( RefreshScheduler::firstAllowedTime(feed, tuesday + 3 * 3600) == tuesday + 4 * 3600 );
+    REQUIRE( RefreshScheduler::firstAllowedTime(feed, tuesday - 1) == tuesday - 1 );
+  }
+
+  SECTION("skipDays")
+  {
+    RSS20::Channel feed;
+    feed.setSkipDays({ Days::Tuesday, Days::Wednesday });
+    //next allowed time is Thursday, 00:00 GMT
+    const std::time_t thursday = tuesday - 4 * 3600 + 2 * 86400;
+    REQUIRE( RefreshScheduler::firstAllowedTime(feed, tuesday) == thursday );
+    REQUIRE( RefreshScheduler::firstAllowedTime(feed, thursday + 10) == thursday + 10 );
+  }
+
+  SECTION("skipDays and skipHours")
+  {
+    RSS20::Channel feed;
+    feed.setSkipDays({ Days::Wednesday });
+    feed.setSkipHours({ 0, 1, 23 });
+    //Tuesday 23:00 is skipped, Wednesday is skipped, Thursday 00:00 and 01:00, too.
+    const std::time_t thursday = tuesday - 4 * 3600 + 2 * 86400;
+    REQUIRE( RefreshScheduler::firstAllowedTime(feed, tuesday + 19 * 3600) == thursday + 2 * 3600 );
+  }
+
+  SECTION("skipping everything is ignored")
+  {
+    RSS20::Channel feed;
+    feed.setSkipDays({ Days::Monday, Days::Tuesday, Days::Wednesday, Days::Thursday,
+                       Days::Friday, Days::Saturday, Days::Sunday });
+    REQUIRE( RefreshScheduler::firstAllowedTime(feed, tuesday) == tuesday );
+
+    RSS20::Channel hourly;
+    std::set<unsigned int> hours;
+    for (unsigned int h = 0; h < 24; ++h)
+      hours.insert(h);
+    hourly.setSkipHours(hours);
+    REQUIRE( RefreshScheduler::firstAllowedTime(hourly, tuesday) == tuesday );
+  }
+
+  SECTION("refresh is moved out of skipped hours")
+  {
+    RefreshScheduler scheduler(1, 600);
+    RSS20::Channel feed;
+    feed.setSkipHours({ 4 });
+    scheduler.refreshed(0, feed, tuesday);
+    REQUIRE( scheduler.refreshTime(0) == tuesday + 3600 );
+  }
+}
@@ -0,0 +1,246 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the test suite for feed merger.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include <catch.hpp>
+#include <string>
+#include "../../../src/rss2.0/Deduplicator.hpp"
+#include "../../../src/rss2.0/Merger.hpp"
+
+namespace
+{
+  RSS20::Item makeItem(const std::string& title, const std::string& link,
+                       const std::string& guid, const std::time_t date)
+  {
+    return RSS20::Item(title, link, "", "", std::set<RSS20::Category>(), "",
+                       RSS20::Enclosure(), RSS20::GUID(guid), date, RSS20::Source());
+  }
+}
+
+TEST_CASE("RSS 2.0 Deduplicator")
+{
+  using namespace RSS20;
+  using Key = Deduplicator::Key;
+
+  SECTION("keysFromString")
+  {
+    std::vector<Key> keys;
+    REQUIRE( Deduplicator::keysFromString("guid,link,title", keys) );
+    REQUIRE( keys == std::vector<Key>({ Key::Guid, Key::Link, Key::TitleAndDate }) );
+    REQUIRE( Deduplicator::keysFromString("link", keys) );
+    REQUIRE( keys == std::vector<Key>({ Key::Link }) );
+
+    REQUIRE_FALSE( Deduplicator::keysFromString("", keys) );
+    REQUIRE_FALSE( Deduplicator::keysFromString("guid,foo", keys) );
+    REQUIRE_FALSE( Deduplicator::keysFromString("guid,,link", keys) );
+  }
+
+  SECTION("preferFromString")
+  {
+    Deduplicator::Prefer prefer = Deduplicator::Prefer::Newest;
+    REQUIRE( Deduplicator::preferFromString("first", prefer) );
+    REQUIRE( prefer == Deduplicator::Prefer::FirstFeed );
+    REQUIRE( Deduplicator::preferFromString("newest", prefer) );
+    REQUIRE( prefer == Deduplicator::Prefer::Newest );
+    REQUIRE_FALSE( Deduplicator::preferFromString("", prefer) );
+    REQUIRE_FALSE( Deduplicator::preferFromString("oldest", prefer) );
+    REQUIRE( Deduplicator().prefer() == Deduplicator::Prefer::Newest );
+  }
+
+  SECTION("same GUID")
+  {
+    Deduplicator dedup({ Key::Guid });
+    REQUIRE( dedup.insert(makeItem("a", "https://a.example/", "id-1", 100)) );
+    REQUIRE( dedup.insert(makeItem("b", "https://b.example/", "id-2", 100)) );
+    REQUIRE_FALSE( dedup.insert(makeItem("c", "https://c.example/", "id-1", 200)) );
+    REQUIRE( dedup.duplicates() == 1 );
+  }
+
+  SECTION("same link")
+  {
+    Deduplicator dedup({ Key::Guid, Key::Link });
+    REQUIRE( dedup.insert(makeItem("a", "https://a.example/", "id-1", 100)) );
+    REQUIRE_FALSE( dedup.insert(makeItem("a", "https://a.example/", "id-2", 100)) );
+    //The GUID of a duplicate is not remembered.
+    REQUIRE( dedup.insert(makeItem("c", "https://c.example/", "id-2", 100)) );
+  }
+
+  SECTION("order of keys does not matter")
+  {
+    for (const auto& keys : { std::vector<Key>({ Key::Guid, Key::Link }),
+                              std::vector<Key>({ Key::Link, Key::Guid }) })
+    {
+      Deduplicator dedup(keys);
+      REQUIRE( dedup.insert(makeItem("a", "https://a.example/", "id-1", 100)) );
+      //Any matching key makes an item a duplicate.
+      REQUIRE_FALSE( dedup.insert(makeItem("b", "https://b.example/", "id-1", 100)) );
+      REQUIRE_FALSE( dedup.insert(makeItem("c", "https://a.example/", "id-3", 100)) );
+      REQUIRE( dedup.duplicates() == 2 );
+    }
+  }
+
+  SECTION("same title and date")
+  {
+    Deduplicator dedup({ Key::TitleAndDate });
+    REQUIRE( dedup.insert(makeItem("a", "https://a.example/", "", 100)) );
+    REQUIRE( dedup.insert(makeItem("a", "https://a.example/", "", 200)) );
+    REQUIRE_FALSE( dedup.insert(makeItem("a", "https://b.example/", "", 100)) );
+  }
+
+  SECTION("empty keys never match")
+  {
+    Deduplicator dedup({ Key::Guid, Key::Link });
+    REQUIRE( dedup.insert(makeItem("a", "", "", 100)) );
+    REQUIRE( dedup.insert(makeItem("b", "", "", 100)) );
+    REQUIRE( dedup.duplicates() == 0 );
+  }
+
+  SECTION("different keys do not match each other")
+  {
+    Deduplicator dedup({ Key::Guid, Key::Link });
+    REQUIRE( dedup.insert(makeItem("a", "https://a.example/", "", 100)) );
+    REQUIRE( dedup.insert(makeItem("b", "", "https://a.example/", 100)) );
+  }
+
+  SECTION("many items")
+  {
+    Deduplicator dedup({ Key::Guid });
+    for (int i = 0; i < 10000; ++i)
+    {
+      REQUIRE( dedup.insert(makeItem("t", "", "id-" + std::to_string(i), 100)) );
+    }
+    for (int i = 0; i < 10000; i += 7)
+    {
+      REQUIRE_FALSE( dedup.insert(makeItem("t", "", "id-" + std::to_string(i), 100)) );
+    }
+    dedup.clear();
+    REQUIRE( dedup.duplicates() == 0 );
+    REQUIRE( dedup.insert(makeItem("t", "", "id-0", 100)) );
+  }
+
+  SECTION("merge keeps the newest copy")
+  {
+    std::vector<Channel> feeds;
+    feeds.push_back(Channel("one", "https://one.example/", "one", {
+        makeItem("1-a", "https://a.example/", "", 100),
+        makeItem("1-b", "https://b.example/", "", 300) }));
+    feeds.push_back(Channel("two", "https://two.example/", "two", {
+        makeItem("2-a", "https://a.example/", "", 200),
+        makeItem("2-c", "https://c.example/", "", 50),
+        makeItem("2-b", "https://b.example/", "", 300) }));
+    Deduplicator dedup({ Key::Link });
+    Channel result;
+    REQUIRE( Merger::mergeSorted(std::move(feeds), result, 0, BasicRSS::Channel::NoDate, &dedup) );
+    REQUIRE( result.items().size() == 3 );
+    REQUIRE( result.items()[0].title() == "1-b" );
+    REQUIRE( result.items()[1].title() == "2-a" );
+    REQUIRE( result.items()[2].title() == "2-c" );
+    REQUIRE( dedup.duplicates() == 2 );
+  }
+
+  SECTION("merge with limit refills feeds that lost duplicates")
+  {
+    std::vector<Channel> feeds;
+    feeds.push_back(Channel("one", "https://one.example/", "one", {
+        makeItem("1-a", "https://a.example/", "", 300),
+        makeItem("1-b", "https://b.example/", "", 200) }));
+    feeds.push_back(Channel("two", "https://two.example/", "two", {
+        makeItem("2-c", "https://c.example/", "", 100),
+        makeItem("2-a", "https://a.example/", "", 300),
+        makeItem("2-b", "https://b.example/", "", 200),
+        makeItem("2-d", "https://d.example/", "", 50) }));
+    Deduplicator dedup({ Key::Link });
+    Channel result;
+    REQUIRE( Merger::mergeSorted(std::move(feeds), result, 3, BasicRSS::Channel::NoDate, &dedup) );
+    REQUIRE( result.items().size() == 3 );
+    REQUIRE( result.items()[0].title() == "1-a" );
+    REQUIRE( result.items()[1].title() == "1-b" );
+    REQUIRE( result.items()[2].title() == "2-c" );
+  }
+
+  SECTION("single feed with limit refills after duplicates")
+  {
+    std::vector<Channel> feeds;
+    feeds.push_back(Channel("one", "https://one.example/", "one", {
+        makeItem("b", "https://b.example/", "", 200),
+        makeItem("a", "https://a.example/", "", 300),
+        makeItem("a-copy", "https://a.example/", "", 300),
+        makeItem("c", "https://c.example/", "", 100) }));
+    Deduplicator dedup({ Key::Link });
+    Channel result;
+    REQUIRE( Merger::mergeSorted(std::move(feeds), result, 2, BasicRSS::Channel::NoDate, &dedup) );
+    REQUIRE( result.items().size() == 2 );
+    REQUIRE( result.items()[0].title() == "a" );
+    REQUIRE( result.items()[1].title() == "b" );
+  }
+
+  SECTION("merge keeps the copy of the first feed")
+  {
+    std::vector<Channel> feeds;
+    feeds.push_back(Channel("one", "https://one.example/", "one", {
+        makeItem("1-a", "https://a.example/", "", 100),
+        makeItem("1-b", "https://b.example/", "", 300) }));
+    feeds.push_back(Channel("two", "https://two.example/", "two", {
+        makeItem("2-a", "https://a.example/", "", 200),
+        makeItem("2-c", "https://c.example/", "", 50),
+        makeItem("2-b", "https://b.example/", "", 300) }));
+    Deduplicator dedup({ Key::Link }, Deduplicator::Prefer::FirstFeed);
+    Channel result;
+    REQUIRE( Merger::mergeSorted(std::move(feeds), result, 0, BasicRSS::Channel::NoDate, &dedup) );
+    REQUIRE( result.items().size() == 3 );
+    REQUIRE( result.items()[0].title() == "1-b" );
+    REQUIRE( result.items()[1].title() == "1-a" );
+    REQUIRE( result.items()[2].title() == "2-c" );
+    REQUIRE( dedup.duplicates() == 2 );
+  }
+
+  SECTION("first feed wins with limit")
+  {
+    std::vector<Channel> feeds;
+    feeds.push_back(Channel("one", "https://one.example/", "one", {
+        makeItem("1-a", "https://a.example/", "", 100) }));
+    feeds.push_back(Channel("two", "https://two.example/", "two", {
+        makeItem("2-a", "https://a.example/", "", 300),
+        makeItem("2-b", "https://b.example/", "", 200) }));
+    Deduplicator dedup({ Key::Link }, Deduplicator::Prefer::FirstFeed);
+    Channel result;
+    REQUIRE( Merger::mergeSorted(std::move(feeds), result, 1, BasicRSS::Channel::NoDate, &dedup) );
+    //The dropped copy of the second feed does not take up the limit.
+    REQUIRE( result.items().size() == 1 );
+    REQUIRE( result.items()[0].title() == "2-b" );
+  }
+
+  SECTION("merge with limit counts unique items")
+  {
+    std::vector<Channel> feeds;
+    feeds.push_back(Channel("one", "https://one.example/", "one", {
+        makeItem("1-a", "https://a.example/", "", 300),
+        makeItem("1-b", "https://b.example/", "", 200) }));
+    feeds.push_back(Channel("two", "https://two.example/", "two", {
+        makeItem("2-a", "https://a.example/", "", 300),
+        makeItem("2-c", "https://c.example/", "", 100) }));
+    Deduplicator dedup({ Key::Link });
+    Channel result;
+    REQUIRE( Merger::mergeSorted(std::move(feeds), result, 3, BasicRSS::Channel::NoDate, &dedup) );
+    REQUIRE( result.items().size() == 3 );
+    REQUIRE( result.items()[0].title() == "1-a" );
+    REQUIRE( result.items()[1].title() == "1-b" );
+    REQUIRE( result.items()[2].title() == "2-c" );
+  }
+}
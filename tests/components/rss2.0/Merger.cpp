@@ -0,0 +1,160 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the test suite for feed merger.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include <catch.hpp>
+#include <algorithm>
+#include <functional>
+#include "../../../src/rss2.0/Merger.hpp"
+
+namespace
+{
+  RSS20::Item makeItem(const std::string& title, const std::time_t date)
+  {
+    return RSS20::Item(title, "https://www.example.com/" + title, "", "",
+                       std::set<RSS20::Category>(), "", RSS20::Enclosure(),
+                       RSS20::GUID(), date, RSS20::Source());
+  }
+
+  RSS20::Channel makeChannel(const std::string& title, const std::vector<RSS20::Item>& items)
+  {
+    RSS20::Channel channel(title, "https://www.example.com/", "Feed " + title, items);
+    return channel;
+  }
+
+  std::vector<std::string> titles(const RSS20::Channel& channel)
+  {
+    std::vector<std::string> result;
+    for (const auto& item : channel.items())
+    {
+      result.push_back(item.title());
+    }
+    return result;
+  }
+}
+
+TEST_CASE("RSS 2.0 Merger")
+{
+  using namespace RSS20;
+
+  SECTION("mergeSorted: no feeds")
+  {
+    std::vector<Channel> feeds;
+    Channel result;
+    REQUIRE_FALSE( Merger::mergeSorted(std::move(feeds), result) );
+  }
+
+  SECTION("mergeSorted: single feed gets sorted")
+  {
+    std::vector<Channel> feeds;
+    feeds.push_back(makeChannel("one", { makeItem("b", 200), makeItem("c", 100), makeItem("a", 300) }));
+    Channel result;
+    REQUIRE( Merger::mergeSorted(std::move(feeds), result) );
+    REQUIRE( result.title() == "one" );
+    REQUIRE( titles(result) == std::vector<std::string>({ "a", "b", "c" }) );
+  }
+
+  SECTION("mergeSorted: items of several feeds are interleaved by date")
+  {
+    std::vector<Channel> feeds;
+    //already sorted, newest first
+    feeds.push_back(makeChannel("one", { makeItem("1-500", 500), makeItem("1-300", 300), makeItem("1-100", 100) }));
+    //oldest first
+    feeds.push_back(makeChannel("two", { makeItem("2-200", 200), makeItem("2-400", 400), makeItem("2-600", 600) }));
+    //unordered
+    feeds.push_back(makeChannel("three", { makeItem("3-250", 250), makeItem("3-700", 700), makeItem("3-50", 50) }));
+    Channel result;
+    REQUIRE( Merger::mergeSorted(std::move(feeds), result) );
+    REQUIRE( result.items().size() == 9 );
+    REQUIRE( titles(result) == std::vector<std::string>({
+             "3-700", "2-600", "1-500", "2-400", "1-300", "3-250",
+             "2-200", "1-100", "3-50" }) );
+  }
+
+  SECTION("mergeSorted: equal dates keep the order of the feeds")
+  {
+    std::vector<Channel> feeds;
+    feeds.push_back(makeChannel("one", { makeItem("1-a", 100), makeItem("1-b", 100) }));
+    feeds.push_back(makeChannel("two", { makeItem("2-a", 100) }));
+    Channel result;
+    REQUIRE( Merger::mergeSorted(std::move(feeds), result) );
+    REQUIRE( titles(result) == std::vector<std::string>({ "1-a", "1-b", "2-a" }) );
+  }
+
+  SECTION("mergeSorted: feed without items becomes an item")
+  {
+    std::vector<Channel> feeds;
+    feeds.push_back(makeChannel("one", { makeItem("1-a", 100) }));
+    Channel empty = makeChannel("empty", { });
+    empty.setPubDate(150);
+    feeds.push_back(empty);
+    Channel result;
+    REQUIRE( Merger::mergeSorted(std::move(feeds), result) );
+    REQUIRE( titles(result) == std::vector<std::string>({ "empty", "1-a" }) );
+    REQUIRE( result.items()[0].description() == "Feed empty" );
+  }
+
+  SECTION("mergeSorted has the same result as merge plus sort")
+  {
+    std::vector<Channel> feeds;
+    feeds.push_back(makeChannel("one", { makeItem("1-500", 500), makeItem("1-300", 300) }));
+    feeds.push_back(makeChannel("two", { makeItem("2-200", 200), makeItem("2-400", 400) }));
+    feeds.push_back(makeChannel("three", { makeItem("3-250", 250) }));
+
+    Channel expected;
+    REQUIRE( Merger::merge(feeds, expected) );
+    auto items = expected.items();
+    std::sort(items.begin(), items.end(), std::greater<Item>());
+    expected.setItems(items);
+
+    Channel result;
+    REQUIRE( Merger::mergeSorted(std::move(feeds), result) );
+    REQUIRE( result == expected );
+  }
+
+  SECTION("mergeSorted: limited number of items")
+  {
+    std::vector<Channel> feeds;
+    feeds.push_back(makeChannel("one", { makeItem("1-100", 100), makeItem("1-500", 500), makeItem("1-300", 300) }));
+    feeds.push_back(makeChannel("two", { makeItem("2-400", 400), makeItem("2-200", 200) }));
+    Channel result;
+    REQUIRE( Merger::mergeSorted(std::move(feeds), result, 3) );
+    REQUIRE( titles(result) == std::vector<std::string>({ "1-500", "2-400", "1-300" }) );
+  }
+
+  SECTION("mergeSorted: limit keeps the first items with equal dates")
+  {
+    std::vector<Channel> feeds;
+    feeds.push_back(makeChannel("one", { makeItem("1-a", 100), makeItem("1-b", 200), makeItem("1-c", 100), makeItem("1-d", 100) }));
+    feeds.push_back(makeChannel("two", { makeItem("2-a", 100) }));
+    Channel result;
+    REQUIRE( Merger::mergeSorted(std::move(feeds), result, 3) );
+    REQUIRE( titles(result) == std::vector<std::string>({ "1-b", "1-a", "1-c" }) );
+  }
+
+  SECTION("mergeSorted: items before a date are left out")
+  {
+    std::vector<Channel> feeds;
+    feeds.push_back(makeChannel("one", { makeItem("1-100", 100), makeItem("1-500", 500), makeItem("1-300", 300) }));
+    feeds.push_back(makeChannel("two", { makeItem("2-200", 200) }));
+    Channel result;
+    REQUIRE( Merger::mergeSorted(std::move(feeds), result, 0, 300) );
+    REQUIRE( titles(result) == std::vector<std::string>({ "1-500", "1-300" }) );
+  }
+}
@@ -0,0 +1,51 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the test suite for feed merger.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include <catch.hpp>
+#include <string>
+#include "../../../src/xml/ElementName.hpp"
+
+TEST_CASE("ElementName")
+{
+  SECTION("known names")
+  {
+    REQUIRE( elementNameFromString("item") == ElementName::Item );
+    REQUIRE( elementNameFromString("pubDate") == ElementName::PubDate );
+    REQUIRE( elementNameFromString("managingEditor") == ElementName::ManagingEditor );
+    REQUIRE( elementNameFromString("email") == ElementName::Email );
+  }
+
+  SECTION("names are case-sensitive")
+  {
+    REQUIRE( elementNameFromString("textInput") == ElementName::TextInput );
+    REQUIRE( elementNameFromString("textinput") == ElementName::TextInputLowercase );
+    REQUIRE( elementNameFromString("Item") == ElementName::Unknown );
+    REQUIRE( elementNameFromString("pubdate") == ElementName::Unknown );
+  }
+
+  SECTION("unknown names")
+  {
+    REQUIRE( elementNameFromString("") == ElementName::Unknown );
+    REQUIRE( elementNameFromString("creator") == ElementName::Unknown );
+    REQUIRE( elementNameFromString("items") == ElementName::Unknown );
+    // The length of the name counts, not just the characters up to NUL.
+    REQUIRE( elementNameFromString(std::string("item\0x", 6)) == ElementName::Unknown );
+  }
+}
@@ -0,0 +1,117 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the feed merger test suite.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include <iostream>
+#include "../../src/Curly.hpp"
+#include "../../src/CurlyHandlePool.hpp"
+
+int main(int argc, char ** argv)
+{
+  if ((argc != 2) || (argv == nullptr) || (argv[1] == nullptr))
+  {
+    std::cout << "Error: Expecting exactly one argument (file name)."
+              << std::endl;
+    return 1;
+  }
+  const std::string url = "file://" + std::string(argv[1]);
+
+  {
+    CurlyHandlePool pool;
+    // Idle handles get reused, a new handle is only created when none is idle.
+    CURL* first = pool.acquire();
+    if (first == nullptr)
+    {
+      std::cout << "Error: Could not acquire handle!" << std::endl;
+      return 1;
+    }
+    pool.release(first);
+    if (pool.idleHandles() != 1)
+    {
+      std::cout << "Error: Pool should have one idle handle!" << std::endl;
+      return 1;
+    }
+    CURL* second = pool.acquire();
+    CURL* other = pool.acquire();
+    if ((second != first) || (other == nullptr) || (other == first)
+        || (pool.idleHandles() != 0))
+    {
+      std::cout << "Error: Pool did not reuse the idle handle!" << std::endl;
+      return 1;
+    }
+    pool.release(other);
+    pool.release(second);
+    if (pool.idleHandles() != 2)
+    {
+      std::cout << "Error: Pool should have two idle handles!" << std::endl;
+      return 1;
+    }
+  }
+
+  // reuse mode without pool
+  {
+    Curly curly;
+    curly.setURL(url);
+    curly.reuseHandle(true);
+    if (!curly.reusesHandle())
+    {
+      std::cout << "Error: Reuse mode was not set!" << std::endl;
+      return 1;
+    }
+    std::string firstResponse;
+    std::string secondResponse;
+    if (!curly.perform(firstResponse) || !curly.perform(secondResponse))
+    {
+      std::cout << "Error: Transfer with reused handle failed!" << std::endl;
+      return 1;
+    }
+    if (firstResponse.empty() || (firstResponse != secondResponse))
+    {
+      std::cout << "Error: Transfers with reused handle returned different "
+                << "data!" << std::endl;
+      return 1;
+    }
+  }
+
+  // transfers with a pool
+  CurlyHandlePool pool;
+  {
+    Curly curly;
+    curly.setURL(url);
+    curly.setHandlePool(&pool);
+    std::string response;
+    for (int i = 0; i < 3; ++i)
+    {
+      if (!curly.perform(response) || response.empty())
+      {
+        std::cout << "Error: Transfer with pooled handle failed!" << std::endl;
+        return 1;
+      }
+      if (pool.idleHandles() != 1)
+      {
+        std::cout << "Error: Handle was not given back to the pool!"
+                  << std::endl;
+        return 1;
+      }
+    } //for
+  }
+
+  std::cout << "Test passed." << std::endl;
+  return 0;
+}
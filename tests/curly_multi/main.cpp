@@ -0,0 +1,149 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the feed merger test suite.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include "../../src/CurlyMulti.hpp"
+
+bool readFile(const std::string& fileName, std::string& content)
+{
+  std::ifstream stream(fileName, std::ios::in | std::ios::binary);
+  if (!stream.good())
+    return false;
+  std::ostringstream buffer;
+  buffer << stream.rdbuf();
+  content = buffer.str();
+  return true;
+}
+
+int main(int argc, char ** argv)
+{
+  if ((argc < 3) || (argv == nullptr))
+  {
+    std::cout << "Error: Expecting at least two arguments (file names)."
+              << std::endl;
+    return 1;
+  }
+
+  std::vector<std::string> fileNames;
+  for (int i = 1; i < argc; ++i)
+  {
+    if (argv[i] == nullptr)
+    {
+      std::cout << "Error: Argument is null!" << std::endl;
+      return 1;
+    }
+    fileNames.push_back(std::string(argv[i]));
+  } //for
+
+  CurlyMulti multi;
+  // Limit transfers, so that some transfers have to wait for a free slot.
+  multi.setMaximumTransfers(2);
+  if (multi.maximumTransfers() != 2)
+  {
+    std::cout << "Error: Maximum number of transfers was not set!" << std::endl;
+    return 1;
+  }
+  for (const auto& name : fileNames)
+  {
+    // Compression has no effect on files, but it must not hurt either.
+    multi.add("file://" + name).enableCompression(true);
+  }
+  // This one does not exist and has to fail.
+  multi.add("file://" + fileNames[0] + ".does-not-exist");
+
+  if (multi.size() != fileNames.size() + 1)
+  {
+    std::cout << "Error: Unexpected number of transfers: " << multi.size()
+              << "!" << std::endl;
+    return 1;
+  }
+
+  std::vector<CurlyMulti::Result> results;
+  if (!multi.performAll(results))
+  {
+    std::cout << "Error: Transfers could not be performed!" << std::endl;
+    return 1;
+  }
+  if (results.size() != multi.size())
+  {
+    std::cout << "Error: Expected " << multi.size() << " results, but got "
+              << results.size() << " instead!" << std::endl;
+    return 1;
+  }
+
+  for (std::size_t i = 0; i < fileNames.size(); ++i)
+  {
+    if (results[i].url != "file://" + fileNames[i])
+    {
+      std::cout << "Error: Result #" << i << " has unexpected URL "
+                << results[i].url << "!" << std::endl;
+      return 1;
+    }
+    if (!results[i].success)
+    {
+      std::cout << "Error: Transfer of " << results[i].url << " failed: "
+                << results[i].error << std::endl;
+      return 1;
+    }
+    std::string expected;
+    if (!readFile(fileNames[i], expected))
+    {
+      std::cout << "Error: Could not read file " << fileNames[i] << "!"
+                << std::endl;
+      return 1;
+    }
+    if (results[i].response != expected)
+    {
+      std::cout << "Error: Response of " << results[i].url
+                << " does not match the file content!" << std::endl;
+      return 1;
+    }
+    // Files are not compressed, so both sizes have to match the file size.
+    if ((multi.transfer(i).getDecodedBytes() != expected.size())
+        || (multi.transfer(i).getDownloadedBytes() != expected.size()))
+    {
+      std::cout << "Error: Unexpected byte counts for " << results[i].url
+                << ": " << multi.transfer(i).getDownloadedBytes() << " bytes "
+                << "received, " << multi.transfer(i).getDecodedBytes()
+                << " bytes decoded, expected " << expected.size() << "."
+                << std::endl;
+      return 1;
+    }
+  } //for
+
+  if (results.back().success || results.back().error.empty())
+  {
+    std::cout << "Error: Transfer of non-existing file did not fail properly!"
+              << std::endl;
+    return 1;
+  }
+
+  // A second run with the same transfers has to work, too.
+  if (!multi.performAll(results) || !results[0].success)
+  {
+    std::cout << "Error: Second run of transfers failed!" << std::endl;
+    return 1;
+  }
+
+  std::cout << "Test passed." << std::endl;
+  return 0;
+}
@@ -0,0 +1,260 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the feed merger test suite.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include "../../src/FeedServer.hpp"
+#include "../../src/GzipStream.hpp"
+
+/* Sends a request to the server and reads the response until the server
+   closes the connection. */
+bool request(const uint16_t port, const std::string& text, std::string& response)
+{
+  const int fd = socket(AF_INET, SOCK_STREAM, 0);
+  if (fd == -1)
+    return false;
+  sockaddr_in address;
+  std::memset(&address, 0, sizeof(address));
+  address.sin_family = AF_INET;
+  address.sin_port = htons(port);
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  if (connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0)
+  {
+    close(fd);
+    return false;
+  }
+  if (send(fd, text.data(), text.size(), 0) != static_cast<ssize_t>(text.size()))
+  {
+    close(fd);
+    return false;
+  }
+  response.clear();
+  char buffer[4096];
+  ssize_t received = 0;
+  while ((received = recv(fd, buffer, sizeof(buffer), 0)) > 0)
+  {
+    response.append(buffer, received);
+  }
+  close(fd);
+  return received == 0;
+}
+
+/* Sends a request with the given method, path and headers and checks that
+   the response starts with the expected status line. */
+bool expectStatus(const uint16_t port, const std::string& method, const std::string& path,
+                  const std::string& headers, const std::string& status, std::string& response)
+{
+  const std::string text = method + " " + path + " HTTP/1.1\r\nHost: localhost\r\n"
+                         + headers + "Connection: close\r\n\r\n";
+  if (!request(port, text, response))
+  {
+    std::cout << "Error: " << method << " request for " << path << " failed!" << std::endl;
+    return false;
+  }
+  if (response.compare(0, status.size() + 11, "HTTP/1.1 " + status + "\r\n") != 0)
+  {
+    std::cout << "Error: Expected status " << status << " for " << method << " "
+              << path << ", but the response is:\n" << response << std::endl;
+    return false;
+  }
+  return true;
+}
+
+/* Gets the value of a header of the response, or an empty string. */
+std::string headerValue(const std::string& response, const std::string& name)
+{
+  const auto pos = response.find("\r\n" + name + ": ");
+  if (pos == std::string::npos)
+    return std::string();
+  const auto start = pos + name.size() + 4;
+  return response.substr(start, response.find("\r\n", start) - start);
+}
+
+/* Gets the body of the response. */
+std::string body(const std::string& response)
+{
+  const auto pos = response.find("\r\n\r\n");
+  return (pos == std::string::npos) ? std::string() : response.substr(pos + 4);
+}
+
+int main()
+{
+  std::string address;
+  uint16_t port = 0;
+  if (!FeedServer::parseListenAddress("8080", address, port)
+      || (address != "127.0.0.1") || (port != 8080))
+  {
+    std::cout << "Error: Port without address was not parsed as expected!" << std::endl;
+    return 1;
+  }
+  if (!FeedServer::parseListenAddress("0.0.0.0:80", address, port)
+      || (address != "0.0.0.0") || (port != 80))
+  {
+    std::cout << "Error: Address and port were not parsed as expected!" << std::endl;
+    return 1;
+  }
+  if (FeedServer::parseListenAddress("65536", address, port)
+      || FeedServer::parseListenAddress("localhost:80", address, port)
+      || FeedServer::parseListenAddress("127.0.0.1:", address, port))
+  {
+    std::cout << "Error: An invalid listen address was accepted!" << std::endl;
+    return 1;
+  }
+
+  FeedServer server;
+  // Port zero lets the system pick a free port.
+  if (!server.start("127.0.0.1", 0) || (server.port() == 0))
+  {
+    std::cout << "Error: Server could not be started!" << std::endl;
+    return 1;
+  }
+  const uint16_t serverPort = server.port();
+
+  std::string response;
+  // Nothing was published yet.
+  if (!expectStatus(serverPort, "GET", "/", "", "503 Service Unavailable", response))
+    return 1;
+
+  // Compressible feed, so that the gzip body is noticeably smaller.
+  std::string feed = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<rss version=\"2.0\"><channel>";
+  for (int i = 0; i < 100; ++i)
+  {
+    feed += "<item><title>Item " + std::to_string(i) + "</title></item>";
+  }
+  feed += "</channel></rss>\n";
+  if (!server.publish(feed))
+  {
+    std::cout << "Error: Feed could not be published!" << std::endl;
+    return 1;
+  }
+
+  if (!expectStatus(serverPort, "GET", "/", "", "200 OK", response))
+    return 1;
+  if (body(response) != feed)
+  {
+    std::cout << "Error: The served feed does not match the published feed!" << std::endl;
+    return 1;
+  }
+  if (headerValue(response, "Content-Length") != std::to_string(feed.size()))
+  {
+    std::cout << "Error: Unexpected Content-Length!" << std::endl;
+    return 1;
+  }
+  const std::string etag = headerValue(response, "ETag");
+  if (etag.empty())
+  {
+    std::cout << "Error: The response has no ETag!" << std::endl;
+    return 1;
+  }
+
+  // A matching ETag means the client's copy is still current.
+  if (!expectStatus(serverPort, "GET", "/", "If-None-Match: " + etag + "\r\n",
+                    "304 Not Modified", response))
+    return 1;
+  if (!body(response).empty())
+  {
+    std::cout << "Error: The 304 response has a body!" << std::endl;
+    return 1;
+  }
+  if (!expectStatus(serverPort, "GET", "/", "If-None-Match: \"other\"\r\n",
+                    "200 OK", response))
+    return 1;
+
+  // Compressed body, if the client accepts gzip.
+  if (!expectStatus(serverPort, "GET", "/", "Accept-Encoding: deflate, gzip\r\n",
+                    "200 OK", response))
+    return 1;
+  std::string compressed;
+  if (!GzipStream::compress(feed, compressed))
+  {
+    std::cout << "Error: Feed could not be compressed!" << std::endl;
+    return 1;
+  }
+  if ((headerValue(response, "Content-Encoding") != "gzip") || (body(response) != compressed))
+  {
+    std::cout << "Error: The feed was not served gzip-compressed!" << std::endl;
+    return 1;
+  }
+  // The compressed body is a different representation with its own ETag.
+  const std::string gzipETag = headerValue(response, "ETag");
+  if (gzipETag.empty() || (gzipETag == etag))
+  {
+    std::cout << "Error: The compressed feed has no ETag of its own!" << std::endl;
+    return 1;
+  }
+  if (!expectStatus(serverPort, "GET", "/", "Accept-Encoding: gzip\r\nIf-None-Match: "
+                    + gzipETag + "\r\n", "304 Not Modified", response))
+    return 1;
+  if (!expectStatus(serverPort, "GET", "/", "Accept-Encoding: gzip\r\nIf-None-Match: "
+                    + etag + "\r\n", "200 OK", response))
+    return 1;
+  if (!expectStatus(serverPort, "GET", "/", "Accept-Encoding: gzip;q=0\r\n",
+                    "200 OK", response))
+    return 1;
+  if (!headerValue(response, "Content-Encoding").empty())
+  {
+    std::cout << "Error: The feed was compressed, although gzip was refused!" << std::endl;
+    return 1;
+  }
+
+  // HEAD gets the headers only.
+  if (!expectStatus(serverPort, "HEAD", "/", "", "200 OK", response))
+    return 1;
+  if (!body(response).empty() || (headerValue(response, "ETag") != etag))
+  {
+    std::cout << "Error: Unexpected response to HEAD request!" << std::endl;
+    return 1;
+  }
+
+  if (!expectStatus(serverPort, "GET", "/other", "", "404 Not Found", response))
+    return 1;
+  if (!expectStatus(serverPort, "POST", "/", "", "405 Method Not Allowed", response))
+    return 1;
+
+  // A new feed gets a new ETag, so the old one does not match anymore.
+  if (!server.publish(feed + "\n"))
+  {
+    std::cout << "Error: Changed feed could not be published!" << std::endl;
+    return 1;
+  }
+  if (!expectStatus(serverPort, "GET", "/", "If-None-Match: " + etag + "\r\n",
+                    "200 OK", response))
+    return 1;
+  if ((body(response) != feed + "\n") || (headerValue(response, "ETag") == etag))
+  {
+    std::cout << "Error: The changed feed was not served!" << std::endl;
+    return 1;
+  }
+
+  server.stop();
+  if (server.port() != 0)
+  {
+    std::cout << "Error: Server is still running after stop()!" << std::endl;
+    return 1;
+  }
+
+  std::cout << "Test passed." << std::endl;
+  return 0;
+}
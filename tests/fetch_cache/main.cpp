@@ -0,0 +1,196 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the feed merger test suite.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include "../../src/Hash.hpp"
+#include "../../src/cache/FetchCache.hpp"
+
+bool hasHeader(const Curly& curly, const std::string& header)
+{
+  const auto& headers = curly.getHeaders();
+  return std::find(headers.begin(), headers.end(), header) != headers.end();
+}
+
+int main(int argc, char ** argv)
+{
+  if ((argc != 2) || (argv == nullptr) || (argv[1] == nullptr))
+  {
+    std::cout << "Error: Expecting exactly one argument (cache directory)."
+              << std::endl;
+    return 1;
+  }
+  const std::string directory = std::string(argv[1]);
+  std::error_code error;
+  std::filesystem::remove_all(directory, error);
+
+  // known FNV-1a values
+  if ((fnv1a("") != 14695981039346656037ULL)
+      || (fnv1a("a") != 0xaf63dc4c8601ec8cULL))
+  {
+    std::cout << "Error: FNV-1a hash returned unexpected value!" << std::endl;
+    return 1;
+  }
+
+  // Header values after a redirect belong to the final response.
+  const std::vector<std::string> headers = {
+      "HTTP/1.1 301 Moved Permanently",
+      "ETag: \"old\"",
+      "Location: https://example.com/new.xml",
+      "",
+      "HTTP/1.1 200 OK",
+      "Content-Type: application/rss+xml",
+      "etag:   \"abc123\"",
+      "Last-Modified: Tue, 10 Jun 2003 04:00:00 GMT",
+      ""
+  };
+  if (FetchCache::headerValue(headers, "ETag") != "\"abc123\"")
+  {
+    std::cout << "Error: Unexpected ETag value: "
+              << FetchCache::headerValue(headers, "ETag") << std::endl;
+    return 1;
+  }
+  if (!FetchCache::headerValue(headers, "Location").empty())
+  {
+    std::cout << "Error: Header of redirect response was used!" << std::endl;
+    return 1;
+  }
+
+  FetchCache cache(directory);
+  if (!cache.create())
+  {
+    std::cout << "Error: Could not create cache directory!" << std::endl;
+    return 1;
+  }
+
+  const std::string url = "https://example.com/new.xml";
+  FetchCache::Entry entry;
+  if (cache.load(url, entry))
+  {
+    std::cout << "Error: Empty cache returned an entry!" << std::endl;
+    return 1;
+  }
+
+  // Responses without validators are not stored.
+  if (cache.store(url, { "HTTP/1.1 200 OK", "Content-Type: text/xml" }, "<rss/>"))
+  {
+    std::cout << "Error: Response without validators was stored!" << std::endl;
+    return 1;
+  }
+
+  const std::string body = std::string("<rss>\n<channel/>\r\n") + '\0' + "</rss>";
+  if (!cache.store(url, headers, body))
+  {
+    std::cout << "Error: Response could not be stored!" << std::endl;
+    return 1;
+  }
+  if (!cache.load(url, entry))
+  {
+    std::cout << "Error: Stored entry could not be loaded!" << std::endl;
+    return 1;
+  }
+  if ((entry.url != url) || (entry.etag != "\"abc123\"")
+      || (entry.lastModified != "Tue, 10 Jun 2003 04:00:00 GMT")
+      || (entry.body != body))
+  {
+    std::cout << "Error: Loaded entry does not match stored data!" << std::endl;
+    return 1;
+  }
+
+  // conditional request headers
+  Curly curly;
+  if (!cache.addConditionalHeaders(url, curly)
+      || !hasHeader(curly, "If-None-Match: \"abc123\"")
+      || !hasHeader(curly, "If-Modified-Since: Tue, 10 Jun 2003 04:00:00 GMT"))
+  {
+    std::cout << "Error: Conditional headers were not added!" << std::endl;
+    return 1;
+  }
+  Curly other;
+  if (cache.addConditionalHeaders("https://example.com/other.xml", other)
+      || !other.getHeaders().empty())
+  {
+    std::cout << "Error: Conditional headers added for unknown URL!" << std::endl;
+    return 1;
+  }
+
+  // validators only
+  FetchCache::Entry validators;
+  validators.body = "unchanged";
+  if (!cache.loadValidators(url, validators) || (validators.etag != "\"abc123\"")
+      || (validators.lastModified != "Tue, 10 Jun 2003 04:00:00 GMT")
+      || (validators.body != "unchanged"))
+  {
+    std::cout << "Error: Validators could not be loaded!" << std::endl;
+    return 1;
+  }
+
+  // A new response without validators removes the outdated entry and snapshot.
+  std::ofstream(cache.snapshotFileName(url)) << "snapshot";
+  if (cache.store(url, { "HTTP/1.1 200 OK", "Content-Type: text/xml" }, "<rss/>"))
+  {
+    std::cout << "Error: Response without validators was stored!" << std::endl;
+    return 1;
+  }
+  if (cache.load(url, entry) || std::filesystem::exists(cache.snapshotFileName(url)))
+  {
+    std::cout << "Error: Outdated entry was not removed!" << std::endl;
+    return 1;
+  }
+
+  // record of the feed versions in a merged feed
+  const std::string output = directory + "/merged.xml";
+  std::vector<FetchCache::Entry> versions;
+  if (cache.loadMergeRecord(output, versions))
+  {
+    std::cout << "Error: Merge record was loaded before it was stored!" << std::endl;
+    return 1;
+  }
+  versions.resize(3);
+  versions[0].url = "https://example.com/a.xml";
+  versions[0].etag = "\"a\"";
+  versions[2].url = "https://example.com/c.xml";
+  versions[2].lastModified = "Tue, 10 Jun 2003 04:00:00 GMT";
+  if (!cache.storeMergeRecord(output, versions))
+  {
+    std::cout << "Error: Merge record could not be stored!" << std::endl;
+    return 1;
+  }
+  std::vector<FetchCache::Entry> loaded;
+  if (!cache.loadMergeRecord(output, loaded) || (loaded.size() != 2)
+      || (loaded[0].url != versions[0].url) || (loaded[0].etag != versions[0].etag)
+      || !loaded[0].lastModified.empty() || (loaded[1].url != versions[2].url)
+      || !loaded[1].etag.empty() || (loaded[1].lastModified != versions[2].lastModified))
+  {
+    std::cout << "Error: Loaded merge record does not match stored data!" << std::endl;
+    return 1;
+  }
+  if (cache.loadMergeRecord(directory + "/other.xml", loaded))
+  {
+    std::cout << "Error: Merge record of another file was loaded!" << std::endl;
+    return 1;
+  }
+
+  std::filesystem::remove_all(directory, error);
+  std::cout << "Test passed." << std::endl;
+  return 0;
+}
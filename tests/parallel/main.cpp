@@ -0,0 +1,99 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the feed merger test suite.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include <atomic>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+#include "../../src/Parallel.hpp"
+
+/* Every index has to be processed exactly once. */
+bool checkAllIndices(const std::size_t count, const unsigned int threads)
+{
+  std::vector<unsigned int> calls(count, 0);
+  std::vector<std::size_t> squares(count, 0);
+  parallelFor(count, threads, [&calls, &squares](const std::size_t idx)
+  {
+    ++calls[idx];
+    squares[idx] = idx * idx;
+  });
+  for (std::size_t idx = 0; idx < count; ++idx)
+  {
+    if ((calls[idx] != 1) || (squares[idx] != idx * idx))
+    {
+      std::cout << "Error: Index " << idx << " was processed " << calls[idx]
+                << " time(s) with " << threads << " thread(s), but it should"
+                << " have been processed once!" << std::endl;
+      return false;
+    }
+  } //for
+  return true;
+}
+
+int main()
+{
+  if (hardwareThreads() == 0)
+  {
+    std::cout << "Error: Number of hardware threads must not be zero!" << std::endl;
+    return 1;
+  }
+
+  const std::vector<std::size_t> counts = { 0, 1, 2, 7, 1000 };
+  const std::vector<unsigned int> threadCounts = { 0, 1, 2, 3, 8, 64 };
+  for (const std::size_t count : counts)
+  {
+    for (const unsigned int threads : threadCounts)
+    {
+      if (!checkAllIndices(count, threads))
+        return 1;
+    } //for
+  } //for
+
+  //Exceptions of tasks reach the caller, but all other tasks still run.
+  std::atomic<std::size_t> done(0);
+  bool caught = false;
+  try
+  {
+    parallelFor(100, 4, [&done](const std::size_t idx)
+    {
+      if (idx == 42)
+        throw std::runtime_error("task failed");
+      ++done;
+    });
+  }
+  catch (const std::runtime_error& ex)
+  {
+    caught = true;
+  }
+  if (!caught)
+  {
+    std::cout << "Error: Exception of task was not passed to the caller!" << std::endl;
+    return 1;
+  }
+  if (done != 99)
+  {
+    std::cout << "Error: " << done << " tasks were done, but 99 tasks were "
+              << "expected!" << std::endl;
+    return 1;
+  }
+
+  std::cout << "parallelFor() works as expected." << std::endl;
+  return 0;
+}
@@ -0,0 +1,335 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the feed merger's test suite.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../../src/StringFunctions.hpp"
+#include "../../src/rfc822/Date.hpp"
+
+/* The previous implementation of rfc822DateTimeToTimeT(), which splits the
+   date into strings, for comparison. */
+static bool legacyRfc822DateTimeToTimeT(const std::string& rfcDate, std::time_t& output)
+{
+  if (rfcDate.empty())
+    return false;
+
+  //Day of week is optional.
+  const bool containsDayOfWeek = rfcDate.find(',') != std::string::npos;
+  if (containsDayOfWeek)
+  {
+    const std::string dayOfWeek = rfcDate.substr(0,3);
+    //check, if day is valid
+    if ((dayOfWeek != "Mon") && (dayOfWeek != "Tue") && (dayOfWeek != "Wed")
+        && (dayOfWeek != "Thu") && (dayOfWeek != "Fri") && (dayOfWeek != "Sat")
+        && (dayOfWeek != "Sun"))
+      return false;
+  } //if day of week is present
+
+  //Use copy of parameter to work with it.
+  std::string workString = (containsDayOfWeek) ? rfcDate.substr(4) : rfcDate;
+  //Remove leading space(s).
+  while (!workString.empty() && workString.at(0) == ' ')
+    workString.erase(0, 1);
+
+  const auto parts = splitAtSeparator(workString, ' ');
+
+  if (parts.size() != 5)
+    return false;
+
+  unsigned int dayOfMonth = 0;
+  if (!stringToUnsignedInt(parts[0], dayOfMonth))
+    return false;
+  if ((dayOfMonth <= 0) || (dayOfMonth > 31))
+    return false;
+  const std::string strMonth = parts[1];
+  unsigned int month = 0;
+  if (strMonth == "Jan")
+    month = 1;
+  else if (strMonth == "Feb")
+    month = 2;
+  else if (strMonth == "Mar")
+    month = 3;
+  else if (strMonth == "Apr")
+    month = 4;
+  else if (strMonth == "May")
+    month = 5;
+  else if (strMonth == "Jun")
+    month = 6;
+  else if (strMonth == "Jul")
+    month = 7;
+  else if (strMonth == "Aug")
+    month = 8;
+  else if (strMonth == "Sep")
+    month = 9;
+  else if (strMonth == "Oct")
+    month = 10;
+  else if (strMonth == "Nov")
+    month = 11;
+  else if (strMonth == "Dec")
+    month = 12;
+  else
+    return false;
+
+  unsigned int year = 0;
+  if (!stringToUnsignedInt(parts[2], year))
+    return false;
+  /* Convert two digit years to four digits.
+     Values greater or equal to 70 will be interpreted as 1970 - 1999.
+     Values below 70 will be interpreted as 2000 - 2069.
+  */
+  if (year < 100)
+  {
+    if (year >= 70)
+      year = 1900 + year;
+    else
+      year = 2000 + year;
+  } //if only two digits (or less)
+
+  //Parse time of the day.
+  const auto timeParts = splitAtSeparator(parts[3], ':');
+  //At least hours and minutes are required.
+  if (timeParts.size() < 2)
+    return false;
+  unsigned int hour = 25;
+  if (!stringToUnsignedInt(timeParts[0], hour))
+    return false;
+  if (hour >= 24)
+    return false;
+  unsigned int minute = 61;
+  if (!stringToUnsignedInt(timeParts[1], minute))
+    return false;
+  if (minute >= 60)
+    return false;
+  unsigned int second = 61;
+  //Seconds are optional, so they may or may not be present.
+  if (timeParts.size() >= 3)
+  {
+    if (!stringToUnsignedInt(timeParts[2], second))
+      return false;
+    if (second >= 60)
+      return false;
+  }
+  else
+    second = 0;
+
+  /* zone        =  "UT"  / "GMT"                ; Universal Time
+                                                 ; North American : UT
+                 /  "EST" / "EDT"                ;  Eastern:  - 5/ - 4
+                 /  "CST" / "CDT"                ;  Central:  - 6/ - 5
+                 /  "MST" / "MDT"                ;  Mountain: - 7/ - 6
+                 /  "PST" / "PDT"                ;  Pacific:  - 8/ - 7
+                 /  1ALPHA                       ; Military: Z = UT;
+                                                 ;  A:-1; (J not used)
+                                                 ;  M:-12; N:+1; Y:+12
+                 / ( ("+" / "-") 4DIGIT )        ; Local differential
+                                                 ;  hours+min. (HHMM) */
+
+  //time offset
+  int offset = 0; //offset in seconds
+  if (parts[4] == "GMT" || parts[4] == "UT" /* not UTC, but UT!*/)
+    offset = 0;
+  else if (parts[4] == "EST") offset = -5 * 60 * 60;
+  else if (parts[4] == "EDT") offset = -4 * 60 * 60;
+  else if (parts[4] == "CST") offset = -6 * 60 * 60;
+  else if (parts[4] == "CDT") offset = -5 * 60 * 60;
+  else if (parts[4] == "MST") offset = -7 * 60 * 60;
+  else if (parts[4] == "MDT") offset = -6 * 60 * 60;
+  else if (parts[4] == "PST") offset = -8 * 60 * 60;
+  else if (parts[4] == "PDT") offset = -7 * 60 * 60;
+  else if (parts[4] == "A") offset = -1 * 60 * 60;
+  else if (parts[4] == "B") offset = -2 * 60 * 60;
+  else if (parts[4] == "C") offset = -3 * 60 * 60;
+  else if (parts[4] == "D") offset = -4 * 60 * 60;
+  else if (parts[4] == "E") offset = -5 * 60 * 60;
+  else if (parts[4] == "F") offset = -6 * 60 * 60;
+  else if (parts[4] == "G") offset = -7 * 60 * 60;
+  else if (parts[4] == "H") offset = -8 * 60 * 60;
+  else if (parts[4] == "I") offset = -9 * 60 * 60;
+  // J not in use
+  else if (parts[4] == "K") offset = -10 * 60 * 60;
+  else if (parts[4] == "L") offset = -11 * 60 * 60;
+  else if (parts[4] == "M") offset = -12 * 60 * 60;
+  else if (parts[4] == "N") offset = +1 * 60 * 60;
+  else if (parts[4] == "O") offset = +2 * 60 * 60;
+  else if (parts[4] == "P") offset = +3 * 60 * 60;
+  else if (parts[4] == "Q") offset = +4 * 60 * 60;
+  else if (parts[4] == "R") offset = +5 * 60 * 60;
+  else if (parts[4] == "S") offset = +6 * 60 * 60;
+  else if (parts[4] == "T") offset = +7 * 60 * 60;
+  else if (parts[4] == "U") offset = +8 * 60 * 60;
+  else if (parts[4] == "V") offset = +9 * 60 * 60;
+  else if (parts[4] == "W") offset = +10 * 60 * 60;
+  else if (parts[4] == "X") offset = +11 * 60 * 60;
+  else if (parts[4] == "Y") offset = +12 * 60 * 60;
+  else if (parts[4].size() == 5)
+  {
+    unsigned int offHours = 0;
+    if (!stringToUnsignedInt(parts[4].substr(1,2), offHours))
+      return false;
+    if (offHours > 12)
+      return false;
+    unsigned int offMinutes = 0;
+    if (!stringToUnsignedInt(parts[4].substr(3,2), offMinutes))
+      return false;
+    if (offMinutes > 59)
+      return false;
+    offset = offHours * 60 * 60 + offMinutes * 60;
+    if (parts[4].at(0) == '-')
+      offset = -offset;
+    else if (parts[4].at(0) != '+')
+      return false;
+  } //else
+  else
+    // invalid timezone / offset specification
+    return false;
+
+  //put data into std::tm
+  struct tm timeStructure;
+  std::memset(&timeStructure, 0, sizeof(struct tm));
+
+  timeStructure.tm_year = year - 1900; //years since 1900
+  timeStructure.tm_mon = month - 1; //months since January
+  timeStructure.tm_mday = dayOfMonth;
+  timeStructure.tm_hour = hour;
+  timeStructure.tm_min = minute;
+  timeStructure.tm_sec = second;
+  timeStructure.tm_gmtoff = offset;
+  timeStructure.tm_isdst = -1; //no information on DST
+
+  const std::time_t tt = std::mktime(&timeStructure);
+  // Return value -1 means failure of mktime().
+  if (tt == -1)
+    return false;
+  output = tt;
+  return true;
+}
+
+/* generates count dates in various formats and time zones */
+std::vector<std::string> generateDates(const unsigned int count)
+{
+  const char* days[] = { "Mon", "Tue", "Wed", "Thu", "Fri", "Sat", "Sun" };
+  const char* months[] = { "Jan", "Feb", "Mar", "Apr", "May", "Jun",
+                           "Jul", "Aug", "Sep", "Oct", "Nov", "Dec" };
+  const char* zones[] = { "GMT", "UT", "EST", "PDT", "Z", "A", "Y", "+0100",
+                          "-0530", "+1200" };
+  std::vector<std::string> dates;
+  dates.reserve(count);
+  for (unsigned int i = 0; i < count; ++i)
+  {
+    std::string date;
+    if (i % 3 != 0)
+      date = std::string(days[i % 7]) + ", ";
+    const unsigned int day = 1 + i % 28;
+    if ((day < 10) && (i % 2 == 0))
+      date += "0";
+    date += std::to_string(day) + " " + months[(i / 7) % 12] + " ";
+    //every tenth date has a two digit year
+    if (i % 10 == 0)
+      date += std::to_string(70 + i % 30);
+    else
+      date += std::to_string(1971 + (i / 13) % 60);
+    /* Hours before four o'clock are left out, because that is when the
+       changes to and from daylight saving time happen in most time zones,
+       and mktime() resolves such times in its own way. */
+    const unsigned int hour = 4 + i % 20;
+    date += " " + std::string(hour < 10 ? "0" : "") + std::to_string(hour)
+          + ":" + std::to_string(10 + i % 50);
+    if (i % 4 != 0)
+      date += ":" + std::to_string(10 + (i / 3) % 50);
+    date += std::string(" ") + zones[i % 10];
+    dates.push_back(date);
+  } //for
+  return dates;
+}
+
+int main(int argc, char ** argv)
+{
+  unsigned int count = 0;
+  if ((argc != 2) || (argv == nullptr) || (argv[1] == nullptr)
+      || !stringToUnsignedInt(std::string(argv[1]), count) || (count == 0))
+  {
+    std::cout << "Error: Expecting the number of dates as only argument." << std::endl;
+    return 1;
+  }
+
+  std::vector<std::string> dates = generateDates(count);
+  //Invalid dates have to be rejected by both implementations.
+  const std::vector<std::string> invalid = {
+      "", "Mon", "Foo, 01 Jan 2015 00:00:00 GMT", "01 Jan 2015 00:00:00",
+      "01 Jan 2015 00:00:00 GMT extra", "01  Jan 2015 00:00:00 GMT",
+      "32 Jan 2015 00:00:00 GMT", "01 Jen 2015 00:00:00 GMT",
+      "01 Jan 2015 24:00:00 GMT", "01 Jan 2015 00:60 GMT",
+      "01 Jan 2015 00:00:60 GMT", "01 Jan 2015 00 GMT", "01 Jan 2015 00:00 J",
+      "01 Jan 2015 00:00 UTC", "01 Jan 2015 00:00 +1300", "01 Jan 2015 00:00 *0100",
+      "01 Jan 20a5 00:00 GMT", "01 Jan 99999999999 00:00 GMT" };
+  dates.insert(dates.end(), invalid.begin(), invalid.end());
+
+  //Both implementations have to agree on every date.
+  for (const auto& date : dates)
+  {
+    std::time_t legacy = 0;
+    std::time_t current = 0;
+    const bool legacyResult = legacyRfc822DateTimeToTimeT(date, legacy);
+    const bool currentResult = rfc822DateTimeToTimeT(date, current);
+    if ((legacyResult != currentResult) || (legacyResult && (legacy != current)))
+    {
+      std::cout << "Error: Results for \"" << date << "\" differ: "
+                << legacyResult << " / " << legacy << " (previous) vs. "
+                << currentResult << " / " << current << " (current)." << std::endl;
+      return 1;
+    }
+  } //for
+
+  std::time_t sum = 0;
+  std::time_t t = 0;
+  const auto start = std::chrono::steady_clock::now();
+  for (const auto& date : dates)
+  {
+    if (legacyRfc822DateTimeToTimeT(date, t))
+      sum += t;
+  } //for
+  const auto legacyEnd = std::chrono::steady_clock::now();
+  for (const auto& date : dates)
+  {
+    if (rfc822DateTimeToTimeT(date, t))
+      sum -= t;
+  } //for
+  const auto end = std::chrono::steady_clock::now();
+  //Use the sum, so that the compiler cannot skip the loops.
+  if (sum != 0)
+  {
+    std::cout << "Error: The sums of both implementations differ." << std::endl;
+    return 1;
+  }
+
+  const double legacySeconds = std::chrono::duration<double>(legacyEnd - start).count();
+  const double currentSeconds = std::chrono::duration<double>(end - legacyEnd).count();
+  std::cout << "Parsed " << dates.size() << " dates." << std::endl
+            << "previous implementation: " << legacySeconds << " s, "
+            << dates.size() / legacySeconds << " dates per second" << std::endl
+            << "current implementation:  " << currentSeconds << " s, "
+            << dates.size() / currentSeconds << " dates per second" << std::endl;
+  if (currentSeconds > 0.0)
+    std::cout << "Speed-up: " << legacySeconds / currentSeconds << std::endl;
+  return 0;
+}
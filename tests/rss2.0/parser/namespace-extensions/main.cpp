@@ -0,0 +1,110 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the feed merger test suite.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include <iostream>
+#include "../../../../src/rss2.0/Parser.hpp"
+
+int main(int argc, char ** argv)
+{
+  if (argc != 2)
+  {
+    std::cout << "Error: Expecting exactly one argument (file name)."
+              << std::endl;
+    return 1;
+  }
+
+  if ((argv == nullptr) || (argv[1] == nullptr))
+  {
+    std::cout << "Error: Argument is null!" << std::endl;
+    return 1;
+  }
+
+  const std::string pathToFeed = std::string(argv[1]);
+
+  //initialize empty feed
+  RSS20::Channel feed = RSS20::Channel("", "", "", std::vector<RSS20::Item>());
+
+  if (!RSS20::Parser::fromFile(pathToFeed, feed))
+  {
+    std::cout << "Error: Could not parse feed " << pathToFeed << " as RSS 2.0!"
+              << std::endl;
+    return 1;
+  }
+
+  if (feed.items().size() != 1)
+  {
+    std::cout << "Error: Feed " << pathToFeed << " should contain exactly one"
+              << " item, but it contains " << feed.items().size() << " items!"
+              << std::endl;
+    return 1;
+  }
+
+  /* Elements of other namespaces (<atom:link>, <atom:title>, <dc:creator>)
+     must neither fail the parsing nor overwrite the RSS 2.0 elements of the
+     same local name. */
+  //channel level
+  if (feed.title() != "Namespace extension test feed")
+  {
+    std::cout << "Error: Unexpected value for feed title: " << feed.title()
+              << "!" << std::endl;
+    return 1;
+  }
+  if (feed.link() != "http://rss2test.example.com/ns/")
+  {
+    std::cout << "Error: Unexpected value for feed link: " << feed.link()
+              << "!" << std::endl;
+    return 1;
+  }
+  if (feed.description() != "Extensions of other namespaces are not part of RSS 2.0.")
+  {
+    std::cout << "Error: Unexpected value for feed description: "
+              << feed.description() << "!" << std::endl;
+    return 1;
+  }
+
+  //item level
+  const RSS20::Item& item = feed.items().at(0);
+  if (item.title() != "Extended item")
+  {
+    std::cout << "Error: Unexpected value for item title: " << item.title()
+              << "!" << std::endl;
+    return 1;
+  }
+  if (item.link() != "http://rss2test.example.com/ns/item1.html")
+  {
+    std::cout << "Error: Unexpected value for item link: " << item.link()
+              << "!" << std::endl;
+    return 1;
+  }
+  if (!item.author().empty())
+  {
+    std::cout << "Error: <dc:creator> must not be used as item author, but "
+              << "author is " << item.author() << "!" << std::endl;
+    return 1;
+  }
+  if (item.guid() != RSS20::GUID("http://www.example.com/guid-ns-1", false))
+  {
+    std::cout << "Error: GUIDs do not match!" << std::endl;
+    return 1;
+  }
+
+  //All is well, so far.
+  return 0;
+}
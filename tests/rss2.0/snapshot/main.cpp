@@ -0,0 +1,185 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the feed merger test suite.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include "../../../src/rss2.0/Parser.hpp"
+#include "../../../src/rss2.0/Snapshot.hpp"
+#include "../../../src/rss2.0/Writer.hpp"
+#include "../../../src/StringFunctions.hpp"
+
+/* Checks that the snapshots of the feed files contain the same feeds, and
+   that broken snapshots are rejected. */
+int roundTrip(const int argc, char ** argv)
+{
+  if (argc < 3)
+  {
+    std::cout << "Error: Expecting 'roundtrip FILE...'." << std::endl;
+    return 1;
+  }
+  for (int i = 2; i < argc; ++i)
+  {
+    if (argv[i] == nullptr)
+    {
+      std::cout << "Error: Argument is null!" << std::endl;
+      return 1;
+    }
+    const std::string fileName = std::string(argv[i]);
+    RSS20::Channel feed;
+    if (!RSS20::Parser::fromFile(fileName, feed))
+    {
+      std::cout << "Error: Could not parse " << fileName << "!" << std::endl;
+      return 1;
+    }
+    std::string data;
+    if (!RSS20::Snapshot::toString(feed, data))
+    {
+      std::cout << "Error: Could not create snapshot of " << fileName << "!" << std::endl;
+      return 1;
+    }
+    RSS20::Channel loaded;
+    if (!RSS20::Snapshot::fromBuffer(data.data(), data.size(), loaded) || (loaded != feed))
+    {
+      std::cout << "Error: Snapshot of " << fileName << " does not contain the same feed!" << std::endl;
+      return 1;
+    }
+    const std::string snapshotFile = "roundtrip-" + std::to_string(i) + ".snapshot";
+    loaded = RSS20::Channel();
+    if (!RSS20::Snapshot::toFile(feed, snapshotFile)
+        || !RSS20::Snapshot::fromFile(snapshotFile, loaded) || (loaded != feed))
+    {
+      std::cout << "Error: Snapshot file of " << fileName << " does not contain the same feed!" << std::endl;
+      return 1;
+    }
+    // Truncated or extended snapshots must be rejected.
+    for (std::size_t size = 0; size < data.size(); ++size)
+    {
+      if (RSS20::Snapshot::fromBuffer(data.data(), size, loaded))
+      {
+        std::cout << "Error: Snapshot of " << fileName << " truncated to " << size
+                  << " bytes was accepted!" << std::endl;
+        return 1;
+      }
+    } //for
+    const std::string extended = data + '\0';
+    if (RSS20::Snapshot::fromBuffer(extended.data(), extended.size(), loaded))
+    {
+      std::cout << "Error: Snapshot of " << fileName << " with trailing data was accepted!" << std::endl;
+      return 1;
+    }
+    std::cout << fileName << ": " << data.size() << " bytes in snapshot." << std::endl;
+  } //for
+  return 0;
+}
+
+/* Creates an RSS 2.0 feed with the given number of items. */
+RSS20::Channel generateFeed(const unsigned int items)
+{
+  RSS20::Channel feed;
+  feed.setTitle("Benchmark feed");
+  feed.setLink("https://example.com/");
+  feed.setDescription("Generated feed for snapshot benchmarks");
+  feed.setLanguage("en-us");
+  const std::time_t newest = 1054612800;
+  feed.setPubDate(newest);
+  std::vector<RSS20::Item> generated;
+  generated.reserve(items);
+  for (unsigned int i = 0; i < items; ++i)
+  {
+    const std::string number = std::to_string(i);
+    generated.push_back(RSS20::Item(
+        "Item number " + number, //title
+        "https://example.com/items/" + number, //link
+        "This is the description of item " + number
+          + ". It contains some <b>markup</b> & a bit more text, like real feeds do.", //description
+        "", //author
+        { RSS20::Category("Benchmarks", "https://example.com/categories"),
+          RSS20::Category("Topic " + std::to_string(i % 10)) },
+        "", //comments
+        RSS20::Enclosure(), //enclosure
+        RSS20::GUID("urn:example:item:" + number, false), //guid
+        newest - 60 * static_cast<std::time_t>(i), //pubDate
+        RSS20::Source()));
+  } //for
+  feed.setItems(std::move(generated));
+  return feed;
+}
+
+/* Compares the time to load a generated feed from its XML and from its
+   snapshot. */
+int benchmark(const int argc, char ** argv)
+{
+  unsigned int items = 0;
+  if ((argc != 3) || (argv[2] == nullptr)
+      || !stringToUnsignedInt(std::string(argv[2]), items) || (items == 0))
+  {
+    std::cout << "Error: Expecting 'benchmark ITEMS' with a positive number of items." << std::endl;
+    return 1;
+  }
+
+  const RSS20::Channel feed = generateFeed(items);
+  const std::string xmlFile = "benchmark-snapshot-rss-2.xml";
+  const std::string snapshotFile = "benchmark-snapshot-rss-2.snapshot";
+  if (!RSS20::Writer::toFile(feed, xmlFile) || !RSS20::Snapshot::toFile(feed, snapshotFile))
+  {
+    std::cout << "Error: Generated feed could not be written!" << std::endl;
+    return 1;
+  }
+
+  RSS20::Channel parsed;
+  const auto start = std::chrono::steady_clock::now();
+  const bool parseSuccess = RSS20::Parser::fromFile(xmlFile, parsed);
+  const auto parseEnd = std::chrono::steady_clock::now();
+  RSS20::Channel loaded;
+  const auto loadStart = std::chrono::steady_clock::now();
+  const bool loadSuccess = RSS20::Snapshot::fromFile(snapshotFile, loaded);
+  const auto end = std::chrono::steady_clock::now();
+  if (!parseSuccess || !loadSuccess || (parsed != feed) || (loaded != feed))
+  {
+    std::cout << "Error: Loaded feeds do not match the generated feed!" << std::endl;
+    return 1;
+  }
+
+  const double parseSeconds = std::chrono::duration<double>(parseEnd - start).count();
+  const double loadSeconds = std::chrono::duration<double>(end - loadStart).count();
+  std::cout << items << " items: Parser::fromFile " << parseSeconds
+            << " s, Snapshot::fromFile " << loadSeconds << " s";
+  if (loadSeconds > 0.0)
+    std::cout << " (" << (parseSeconds / loadSeconds) << " times as fast)";
+  std::cout << std::endl;
+  return 0;
+}
+
+int main(int argc, char ** argv)
+{
+  if ((argc < 2) || (argv == nullptr) || (argv[1] == nullptr))
+  {
+    std::cout << "Error: Expecting 'roundtrip FILE...' or 'benchmark ITEMS'." << std::endl;
+    return 1;
+  }
+  const std::string command = std::string(argv[1]);
+  if (command == "roundtrip")
+    return roundTrip(argc, argv);
+  if (command == "benchmark")
+    return benchmark(argc, argv);
+  std::cout << "Error: Unknown command " << command << "!" << std::endl;
+  return 1;
+}
@@ -0,0 +1,184 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the feed merger test suite.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <sys/resource.h>
+#include "../../../src/rss2.0/Parser.hpp"
+#include "../../../src/rss2.0/StreamParser.hpp"
+#include "../../../src/StringFunctions.hpp"
+
+/* Both parsers have to produce the same feed for the given files. */
+int compareParsers(const int argc, char ** argv)
+{
+  if (argc < 3)
+  {
+    std::cout << "Error: Expecting at least one file name after 'compare'."
+              << std::endl;
+    return 1;
+  }
+  for (int i = 2; i < argc; ++i)
+  {
+    if (argv[i] == nullptr)
+    {
+      std::cout << "Error: Argument is null!" << std::endl;
+      return 1;
+    }
+    const std::string pathToFeed = std::string(argv[i]);
+    RSS20::Channel domFeed;
+    if (!RSS20::Parser::fromFile(pathToFeed, domFeed))
+    {
+      std::cout << "Error: Parser could not parse " << pathToFeed << "!"
+                << std::endl;
+      return 1;
+    }
+    RSS20::Channel streamFeed;
+    if (!RSS20::StreamParser::fromFile(pathToFeed, streamFeed))
+    {
+      std::cout << "Error: StreamParser could not parse " << pathToFeed << "!"
+                << std::endl;
+      return 1;
+    }
+    if (streamFeed != domFeed)
+    {
+      std::cout << "Error: StreamParser and Parser have different results for "
+                << pathToFeed << "!" << std::endl;
+      return 1;
+    }
+    //Parsing from memory has to give the same results, too.
+    std::ifstream stream(pathToFeed, std::ios::in | std::ios::binary);
+    std::ostringstream buffer;
+    buffer << stream.rdbuf();
+    const std::string source = buffer.str();
+    RSS20::Channel bufferFeed;
+    if (!RSS20::Parser::fromBuffer(source.data(), source.size(), bufferFeed)
+        || (bufferFeed != domFeed))
+    {
+      std::cout << "Error: Parser::fromBuffer() has a different result for "
+                << pathToFeed << "!" << std::endl;
+      return 1;
+    }
+    if (!RSS20::StreamParser::fromBuffer(source.data(), source.size(), bufferFeed)
+        || (bufferFeed != domFeed))
+    {
+      std::cout << "Error: StreamParser::fromBuffer() has a different result for "
+                << pathToFeed << "!" << std::endl;
+      return 1;
+    }
+    std::cout << "OK: " << pathToFeed << std::endl;
+  } //for
+  return 0;
+}
+
+/* Creates an RSS 2.0 feed with the given number of items. */
+std::string generateFeed(const unsigned int items)
+{
+  std::string feed = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+      "<rss version=\"2.0\">\n  <channel>\n"
+      "    <title>Benchmark feed</title>\n"
+      "    <link>https://example.com/</link>\n"
+      "    <description>Generated feed for parser benchmarks</description>\n"
+      "    <language>en-us</language>\n"
+      "    <pubDate>Tue, 10 Jun 2003 04:00:00 GMT</pubDate>\n";
+  for (unsigned int i = 0; i < items; ++i)
+  {
+    const std::string number = std::to_string(i);
+    feed.append("    <item>\n      <title>Item number ").append(number)
+        .append("</title>\n      <link>https://example.com/items/").append(number)
+        .append("</link>\n      <description>This is the description of item ")
+        .append(number).append(". It contains some &lt;b&gt;escaped markup&lt;/b&gt;"
+                               " &amp; a bit more text, like real feeds do.</description>\n")
+        .append("      <category domain=\"https://example.com/categories\">Benchmarks</category>\n")
+        .append("      <guid isPermaLink=\"false\">urn:example:item:").append(number)
+        .append("</guid>\n      <pubDate>Mon, 02 Jun 2003 ")
+        .append(i % 24 < 10 ? "0" : "").append(std::to_string(i % 24)).append(":")
+        .append(i % 60 < 10 ? "0" : "").append(std::to_string(i % 60))
+        .append(":00 GMT</pubDate>\n    </item>\n");
+  } //for
+  feed.append("  </channel>\n</rss>\n");
+  return feed;
+}
+
+/* Measures throughput and peak memory of one of the parsers. */
+int benchmark(const int argc, char ** argv)
+{
+  if ((argc != 4) || (argv[2] == nullptr) || (argv[3] == nullptr))
+  {
+    std::cout << "Error: Expecting 'benchmark dom|stream ITEMS'." << std::endl;
+    return 1;
+  }
+  const std::string mode = std::string(argv[2]);
+  if ((mode != "dom") && (mode != "stream"))
+  {
+    std::cout << "Error: Mode must be 'dom' or 'stream'." << std::endl;
+    return 1;
+  }
+  unsigned int items = 0;
+  if (!stringToUnsignedInt(std::string(argv[3]), items) || (items == 0))
+  {
+    std::cout << "Error: Number of items must be a positive integer." << std::endl;
+    return 1;
+  }
+
+  const std::string source = generateFeed(items);
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  const long baselineKiB = usage.ru_maxrss;
+
+  RSS20::Channel feed;
+  const auto start = std::chrono::steady_clock::now();
+  const bool success = (mode == "dom") ? RSS20::Parser::fromString(source, feed)
+                                       : RSS20::StreamParser::fromString(source, feed);
+  const auto end = std::chrono::steady_clock::now();
+  if (!success || (feed.items().size() != items))
+  {
+    std::cout << "Error: Generated feed could not be parsed!" << std::endl;
+    return 1;
+  }
+  getrusage(RUSAGE_SELF, &usage);
+
+  const double seconds = std::chrono::duration<double>(end - start).count();
+  const double megaBytes = source.size() / (1024.0 * 1024.0);
+  std::cout << mode << " parser: " << items << " items, " << megaBytes << " MiB in "
+            << seconds << " s, " << (seconds > 0.0 ? megaBytes / seconds : 0.0)
+            << " MiB/s, peak RSS " << usage.ru_maxrss << " KiB (" << baselineKiB
+            << " KiB before parsing)" << std::endl;
+  return 0;
+}
+
+int main(int argc, char ** argv)
+{
+  if ((argc < 2) || (argv == nullptr) || (argv[1] == nullptr))
+  {
+    std::cout << "Error: Expecting 'compare FILE ...' or 'benchmark dom|stream ITEMS'."
+              << std::endl;
+    return 1;
+  }
+  const std::string command = std::string(argv[1]);
+  if (command == "compare")
+    return compareParsers(argc, argv);
+  if (command == "benchmark")
+    return benchmark(argc, argv);
+  std::cout << "Error: Unknown command " << command << "!" << std::endl;
+  return 1;
+}
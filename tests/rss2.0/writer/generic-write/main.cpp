@@ -1,7 +1,7 @@
 /*
  -------------------------------------------------------------------------------
     This file is part of the feed merger test suite.
-    Copyright (C) 2015, 2017  Dirk Stolle
+    Copyright (C) 2015, 2017, 2026  Dirk Stolle
 
     This program is free software: you can redistribute it and/or modify
     it under the terms of the GNU General Public License as published by
@@ -18,7 +18,9 @@
  -------------------------------------------------------------------------------
 */
 
+#include <fstream>
 #include <iostream>
+#include <sstream>
 #include "../../../../src/rss2.0/Channel.hpp"
 #include "../../../../src/rss2.0/Parser.hpp"
 #include "../../../../src/rss2.0/Writer.hpp"
@@ -105,6 +107,37 @@ int main(void)
     return 1;
   }
 
+  /* Writing to memory or to a stream has to give the same document as
+     writing to a file. */
+  std::ifstream file(fileName, std::ios::in | std::ios::binary);
+  std::ostringstream fileContent;
+  fileContent << file.rdbuf();
+  std::string written;
+  if (!RSS20::Writer::toString(outputChannel, written))
+  {
+    std::cout << "Error: Could not write feed to string!" << std::endl;
+    return 1;
+  }
+  if (written != fileContent.str())
+  {
+    std::cout << "Error: String and file contents do not match!" << std::endl;
+    return 1;
+  }
+  std::ostringstream stream;
+  if (!RSS20::Writer::toStream(outputChannel, stream) || (stream.str() != written))
+  {
+    std::cout << "Error: Stream and string contents do not match!" << std::endl;
+    return 1;
+  }
+  //Reused buffers must not keep data of the previous document.
+  std::vector<char> buffer(written.size() + 42, 'x');
+  if (!RSS20::Writer::toBuffer(outputChannel, buffer)
+      || (std::string(buffer.begin(), buffer.end()) != written))
+  {
+    std::cout << "Error: Buffer and string contents do not match!" << std::endl;
+    return 1;
+  }
+
   //All is well, so far.
   return 0;
 }
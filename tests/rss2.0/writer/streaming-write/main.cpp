@@ -0,0 +1,152 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the feed merger test suite.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <sys/resource.h>
+#include <libxml/tree.h>
+#include "../../../../src/rss2.0/Parser.hpp"
+#include "../../../../src/rss2.0/Writer.hpp"
+#include "../../../../src/StringFunctions.hpp"
+
+/* Creates an RSS 2.0 feed with the given number of items. */
+RSS20::Channel generateFeed(const unsigned int items)
+{
+  RSS20::Channel feed;
+  feed.setTitle("Benchmark feed");
+  feed.setLink("https://example.com/");
+  feed.setDescription("Generated feed for writer benchmarks");
+  feed.setLanguage("en-us");
+  const std::time_t newest = 1054612800;
+  feed.setPubDate(newest);
+  std::vector<RSS20::Item> generated;
+  generated.reserve(items);
+  for (unsigned int i = 0; i < items; ++i)
+  {
+    const std::string number = std::to_string(i);
+    generated.push_back(RSS20::Item(
+        "Item number " + number, //title
+        "https://example.com/items/" + number, //link
+        "This is the description of item " + number
+          + ". It contains some <b>markup</b> & a bit more text, like real feeds do.", //description
+        "", //author
+        { RSS20::Category("Benchmarks", "https://example.com/categories") },
+        "", //comments
+        RSS20::Enclosure(), //enclosure
+        RSS20::GUID("urn:example:item:" + number, false), //guid
+        newest - 60 * static_cast<std::time_t>(i), //pubDate
+        RSS20::Source()));
+  } //for
+  feed.setItems(std::move(generated));
+  return feed;
+}
+
+/* Writes the feed the way the writer did before streaming was implemented:
+   build the whole document in memory first, then save it to the file. */
+bool writeViaDocument(const RSS20::Channel& feed, const std::string& fileName)
+{
+  xmlDocPtr document = nullptr;
+  xmlTextWriterPtr writer = xmlNewTextWriterDoc(&document, 0);
+  if (nullptr == writer)
+  {
+    if (nullptr != document)
+      xmlFreeDoc(document);
+    return false;
+  }
+  const bool success = RSS20::Writer::toWriter(feed, writer);
+  xmlFreeTextWriter(writer);
+  if (!success)
+  {
+    if (nullptr != document)
+      xmlFreeDoc(document);
+    return false;
+  }
+  const int ret = xmlSaveFormatFileEnc(fileName.c_str(), document, "UTF-8", 1);
+  xmlFreeDoc(document);
+  return ret >= 0;
+}
+
+/* Measures time and peak memory of writing a generated feed. */
+int benchmark(const int argc, char ** argv)
+{
+  if ((argc != 4) || (argv[2] == nullptr) || (argv[3] == nullptr))
+  {
+    std::cout << "Error: Expecting 'benchmark dom|stream ITEMS'." << std::endl;
+    return 1;
+  }
+  const std::string mode = std::string(argv[2]);
+  if ((mode != "dom") && (mode != "stream"))
+  {
+    std::cout << "Error: Mode must be 'dom' or 'stream'." << std::endl;
+    return 1;
+  }
+  unsigned int items = 0;
+  if (!stringToUnsignedInt(std::string(argv[3]), items) || (items == 0))
+  {
+    std::cout << "Error: Number of items must be a positive integer." << std::endl;
+    return 1;
+  }
+
+  const RSS20::Channel feed = generateFeed(items);
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  const long baselineKiB = usage.ru_maxrss;
+
+  const std::string fileName = "benchmark-" + mode + "-rss-2.xml";
+  const auto start = std::chrono::steady_clock::now();
+  const bool success = (mode == "dom") ? writeViaDocument(feed, fileName)
+                                       : RSS20::Writer::toFile(feed, fileName);
+  const auto end = std::chrono::steady_clock::now();
+  if (!success)
+  {
+    std::cout << "Error: Generated feed could not be written!" << std::endl;
+    return 1;
+  }
+  getrusage(RUSAGE_SELF, &usage);
+
+  /* The written file has to contain the same feed. */
+  RSS20::Channel readFeed;
+  if (!RSS20::Parser::fromFile(fileName, readFeed) || (readFeed != feed))
+  {
+    std::cout << "Error: Written feed does not match the generated feed!" << std::endl;
+    return 1;
+  }
+
+  const double seconds = std::chrono::duration<double>(end - start).count();
+  std::cout << mode << " writer: " << items << " items in " << seconds
+            << " s, peak RSS " << usage.ru_maxrss << " KiB (" << baselineKiB
+            << " KiB before writing)" << std::endl;
+  return 0;
+}
+
+int main(int argc, char ** argv)
+{
+  if ((argc < 2) || (argv == nullptr) || (argv[1] == nullptr))
+  {
+    std::cout << "Error: Expecting 'benchmark dom|stream ITEMS'." << std::endl;
+    return 1;
+  }
+  const std::string command = std::string(argv[1]);
+  if (command == "benchmark")
+    return benchmark(argc, argv);
+  std::cout << "Error: Unknown command " << command << "!" << std::endl;
+  return 1;
+}
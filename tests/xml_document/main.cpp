@@ -0,0 +1,106 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the feed merger test suite.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <utility>
+#include "../../src/rss2.0/Parser.hpp"
+#include "../../src/xml/XMLDocument.hpp"
+
+/* checks that the document can be parsed as the expected feed */
+bool matches(const XMLDocumentView doc, const RSS20::Channel& expected)
+{
+  RSS20::Channel feed;
+  return RSS20::Parser::fromDocument(doc, feed) && (feed == expected);
+}
+
+int main(int argc, char ** argv)
+{
+  if ((argc != 2) || (argv == nullptr) || (argv[1] == nullptr))
+  {
+    std::cout << "Error: Expecting exactly one argument (file name)."
+              << std::endl;
+    return 1;
+  }
+  const std::string pathToFeed = std::string(argv[1]);
+
+  std::ifstream stream(pathToFeed, std::ios::in | std::ios::binary);
+  std::ostringstream buffer;
+  buffer << stream.rdbuf();
+  const std::string data = buffer.str();
+  if (data.empty())
+  {
+    std::cout << "Error: Could not read " << pathToFeed << "!" << std::endl;
+    return 1;
+  }
+
+  RSS20::Channel expected;
+  if (!RSS20::Parser::fromString(data, expected))
+  {
+    std::cout << "Error: Could not parse " << pathToFeed << "!" << std::endl;
+    return 1;
+  }
+
+  XMLDocument original(data.data(), data.size());
+  if (!original.isParsed() || !matches(original, expected))
+  {
+    std::cout << "Error: Parsed document does not match the feed!" << std::endl;
+    return 1;
+  }
+
+  //move construction passes the tree on
+  XMLDocument moved(std::move(original));
+  if (original.isParsed() || !moved.isParsed() || !matches(moved.view(), expected))
+  {
+    std::cout << "Error: Move construction did not transfer the document!" << std::endl;
+    return 1;
+  }
+
+  //move assignment frees the old tree and takes the new one
+  XMLDocument assigned(data.data(), data.size());
+  assigned = std::move(moved);
+  if (moved.isParsed() || !assigned.isParsed() || !matches(assigned, expected))
+  {
+    std::cout << "Error: Move assignment did not transfer the document!" << std::endl;
+    return 1;
+  }
+
+  //A clone has to survive the destruction of its original.
+  XMLDocument copy = assigned.clone();
+  {
+    const XMLDocument dying(std::move(assigned));
+  }
+  if (!copy.isParsed() || !matches(copy, expected))
+  {
+    std::cout << "Error: Clone does not match the original document!" << std::endl;
+    return 1;
+  }
+
+  //Cloning an unparsed document gives an unparsed document.
+  if (assigned.clone().isParsed() || XMLDocumentView().isParsed())
+  {
+    std::cout << "Error: Clone or view of nothing is parsed!" << std::endl;
+    return 1;
+  }
+
+  std::cout << "Moving, cloning and viewing XML documents works." << std::endl;
+  return 0;
+}
@@ -0,0 +1,164 @@
+/*
+ -------------------------------------------------------------------------------
+    This file is part of the feed merger test suite.
+    Copyright (C) 2026  Dirk Stolle
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ -------------------------------------------------------------------------------
+*/
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include "../../src/Curly.hpp"
+#include "../../src/rss2.0/Parser.hpp"
+#include "../../src/xml/XMLDocument.hpp"
+#include "../../src/xml/XMLPushParser.hpp"
+
+/* parses the data in chunks of the given size */
+bool parseInChunks(const std::string& data, const std::size_t chunkSize, RSS20::Channel& feed)
+{
+  XMLPushParser parser;
+  for (std::size_t offset = 0; offset < data.size(); offset += chunkSize)
+  {
+    const std::size_t size = std::min(chunkSize, data.size() - offset);
+    if (!parser.push(data.data() + offset, size))
+      return false;
+  } //for
+  if (!parser.finish())
+    return false;
+  const XMLDocument doc(parser.takeDocument());
+  return RSS20::Parser::fromDocument(doc, feed);
+}
+
+int main(int argc, char ** argv)
+{
+  if ((argc != 2) || (argv == nullptr) || (argv[1] == nullptr))
+  {
+    std::cout << "Error: Expecting exactly one argument (file name)."
+              << std::endl;
+    return 1;
+  }
+  const std::string pathToFeed = std::string(argv[1]);
+
+  std::ifstream stream(pathToFeed, std::ios::in | std::ios::binary);
+  std::ostringstream buffer;
+  buffer << stream.rdbuf();
+  const std::string data = buffer.str();
+  if (data.empty())
+  {
+    std::cout << "Error: Could not read file " << pathToFeed << "!" << std::endl;
+    return 1;
+  }
+
+  RSS20::Channel expected;
+  if (!RSS20::Parser::fromFile(pathToFeed, expected))
+  {
+    std::cout << "Error: Could not parse feed " << pathToFeed << " as RSS 2.0!"
+              << std::endl;
+    return 1;
+  }
+
+  // Chunk boundaries must not make a difference, even within UTF-8 sequences.
+  for (const std::size_t chunkSize : { 1, 7, 64, 4096 })
+  {
+    RSS20::Channel feed;
+    if (!parseInChunks(data, chunkSize, feed))
+    {
+      std::cout << "Error: Could not parse feed in chunks of " << chunkSize
+                << " bytes!" << std::endl;
+      return 1;
+    }
+    if (feed != expected)
+    {
+      std::cout << "Error: Feed parsed in chunks of " << chunkSize
+                << " bytes differs from feed parsed from file!" << std::endl;
+      return 1;
+    }
+  } //for
+
+  // Truncated data is not well-formed.
+  {
+    XMLPushParser parser;
+    parser.push(data.data(), data.size() / 2);
+    if (parser.finish() || !parser.failed() || (parser.takeDocument() != nullptr))
+    {
+      std::cout << "Error: Truncated document was accepted!" << std::endl;
+      return 1;
+    }
+  }
+
+  // No data at all is not a document either.
+  {
+    XMLPushParser parser;
+    if (parser.finish() || (parser.takeDocument() != nullptr))
+    {
+      std::cout << "Error: Empty data was accepted!" << std::endl;
+      return 1;
+    }
+  }
+
+  // Transfer with the parser as write sink.
+  {
+    XMLPushParser parser;
+    Curly curly;
+    curly.setURL("file://" + pathToFeed);
+    curly.setWriteSink([&parser](const char* chunk, const std::size_t size)
+    {
+      return parser.push(chunk, size);
+    });
+    std::string response;
+    if (!curly.perform(response))
+    {
+      std::cout << "Error: Transfer with write sink failed!" << std::endl;
+      return 1;
+    }
+    if (!response.empty() || (curly.getDecodedBytes() != data.size()))
+    {
+      std::cout << "Error: Unexpected response data for transfer with sink!"
+                << std::endl;
+      return 1;
+    }
+    if (!parser.finish())
+    {
+      std::cout << "Error: Transferred data could not be parsed!" << std::endl;
+      return 1;
+    }
+    RSS20::Channel feed;
+    const XMLDocument doc(parser.takeDocument());
+    if (!RSS20::Parser::fromDocument(doc, feed) || (feed != expected))
+    {
+      std::cout << "Error: Transferred feed differs from feed parsed from file!"
+                << std::endl;
+      return 1;
+    }
+  }
+
+  // A sink that returns false aborts the transfer.
+  {
+    Curly curly;
+    curly.setURL("file://" + pathToFeed);
+    curly.setWriteSink([](const char*, const std::size_t) { return false; });
+    std::string response;
+    if (curly.perform(response))
+    {
+      std::cout << "Error: Transfer was not aborted by write sink!" << std::endl;
+      return 1;
+    }
+  }
+
+  std::cout << "Test passed." << std::endl;
+  return 0;
+}